@@ -0,0 +1,143 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHASSETPACK_H__
+#define __PHASSETPACK_H__
+
+#include <string>
+#include <boost/noncopyable.hpp>
+#include "config.h"
+
+namespace phoenix
+{
+
+	//! Memory-mapped asset pack.
+	/*!
+		An asset pack bundles many files (textures, fonts, shaders) into a single file that is
+		memory mapped when opened, instead of opening and reading each file separately. Files are
+		found through a hashed table of contents, and their contents are handed out as pointers into
+		the mapping so loaders can decode them without copying. Use the phxpack tool to build a pack
+		from a directory.
+
+		The layout is a Header, followed by a table of Header::slots Entry structures (open addressing,
+		linear probing, empty slots have a size and offset of zero), followed by the names and the data.
+		All values are stored in the byte order of the machine that built the pack.
+
+		\sa RenderSystem::loadTexture(), BMFontLoader::load(), Shader::load()
+	*/
+	class AssetPack
+		: boost::noncopyable
+	{
+
+	public:
+
+		//! Pack header
+		struct Header
+		{
+			char magic[8]; //!< Always "PHXPACK"
+			unsigned int version; //!< Format version
+			unsigned int count; //!< Number of files
+			unsigned int slots; //!< Size of the table, always a power of two
+		};
+
+		//! Table of contents entry
+		struct Entry
+		{
+			unsigned int hash; //!< Hash of the name
+			unsigned int name_offset; //!< Offset of the name from the start of the pack
+			unsigned int name_length; //!< Length of the name
+			unsigned int offset; //!< Offset of the data from the start of the pack
+			unsigned int size; //!< Size of the data
+		};
+
+		//! Current format version.
+		static const unsigned int VERSION = 1;
+
+		//! Constructor
+		AssetPack();
+
+		//! Constructs and opens the given pack.
+		explicit AssetPack( const std::string& _fn );
+
+		//! Destructor, unmaps the file.
+		virtual ~AssetPack();
+
+		//! Open
+		/*!
+			Maps the pack into memory and checks its header.
+			\return True if the file is a valid pack.
+		*/
+		bool open( const std::string& _fn );
+
+		//! Unmaps the pack. Any pointers returned by find() become invalid.
+		void close();
+
+		//! Checks if a pack is open.
+		inline bool isOpen() const { return data != NULL; }
+
+		//! Gets the filename of the pack.
+		inline const std::string& getFilename() const { return filename; }
+
+		//! Gets the number of files in the pack.
+		inline unsigned int count() const { return header ? header->count : 0; }
+
+		//! Find
+		/*!
+			Looks up a file in the pack.
+			\param _name The name of the file, relative to the directory the pack was built from using '/' as the separator.
+			\param _data Set to the file's contents, which stay valid until the pack is closed.
+			\param _size Set to the size of the file.
+			\return False if the file isn't in the pack.
+		*/
+		bool find( const std::string& _name, const unsigned char*& _data, unsigned int& _size ) const;
+
+		//! Checks if a file is in the pack.
+		inline bool contains( const std::string& _name ) const
+		{
+			const unsigned char* d;
+			unsigned int s;
+			return find( _name, d, s );
+		}
+
+		//! Hashes a file name (32-bit FNV-1a).
+		static unsigned int hash( const char* _s, unsigned int _len );
+
+		//! Normalizes a file name to the form stored in the pack ('/' separators, no leading "./").
+		static std::string normalize( const std::string& _name );
+
+	protected:
+
+		//! Name of the mapped file
+		std::string filename;
+
+		//! Mapped data
+		const unsigned char* data;
+
+		//! Size of the mapped data
+		size_t size;
+
+		//! Header, points into data
+		const Header* header;
+
+		//! Table of contents, points into data
+		const Entry* entries;
+
+#ifdef WIN32
+		//! File handle
+		void* file;
+
+		//! File mapping handle
+		void* mapping;
+#endif
+
+	};
+
+} //namespace phoenix
+
+#endif //__PHASSETPACK_H__
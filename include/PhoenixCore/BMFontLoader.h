@@ -1,47 +1,69 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-#ifndef __PHBITMAPFONTLDR_H__
-#define __PHBITMAPFONTLDR_H__
-
-#include <string>
-#include <fstream>
-#include <iostream>
-#include <vector>
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
-#include "config.h"
-#include "BitmapFont.h"
-
-namespace phoenix
-{
-
-//! BMFont Text format Loader
-/*!
-    This class provides means to load a font created by AngelCode's BMFont tool.
-*/
-class BMFontLoader
-{
-
-public:
-	BMFontLoader( RenderSystem& _r, BitmapFontPtr _font )
-		: system(_r), font(_font)
-	{};
-
-	void load( const std::string& fnt_file );
-	void loadFromString( const std::string& _data, const std::string& _directory = "" );
-
-private:
-	RenderSystem& system;
-	BitmapFontPtr font;
-
-};
-
-} //namespace phoenix
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHBITMAPFONTLDR_H__
+#define __PHBITMAPFONTLDR_H__
+
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <boost/algorithm/string.hpp>
+#include <boost/tokenizer.hpp>
+#include "config.h"
+#include "BitmapFont.h"
+#include "AssetPack.h"
+
+namespace phoenix
+{
+
+//! BMFont Loader
+/*!
+    This class provides means to load a font created by AngelCode's BMFont tool, in either the text
+    or the binary (version 3) format. The format is detected from the data. Fonts can have characters
+    from the whole unicode range, and the glyph for missing characters (id -1) is used for any character
+    the font doesn't have.
+*/
+class BMFontLoader
+{
+
+public:
+	BMFontLoader( RenderSystem& _r, BitmapFontPtr _font )
+		: system(_r), font(_font), pack(NULL)
+	{};
+
+	void load( const std::string& fnt_file );
+	void loadFromString( const std::string& _data, const std::string& _directory = "" );
+
+	//! Loads a FNT file and its pages from an asset pack, parsing straight from the mapped data.
+	void load( const AssetPack& _pack, const std::string& fnt_file );
+
+	//! Parses a FNT file from the given range of characters.
+	void loadFromMemory( const char* _begin, const char* _end, const std::string& _directory = "" );
+
+protected:
+
+	//! Parses the text format in a single pass, without copying it.
+	void loadText( const char* _begin, const char* _end, const std::string& _directory );
+
+	//! Parses the binary format.
+	void loadBinary( const unsigned char* _begin, const unsigned char* _end, const std::string& _directory );
+
+	//! Loads a page texture and gives it to the font.
+	void loadPage( unsigned int _id, const std::string& _file );
+
+private:
+	RenderSystem& system;
+	BitmapFontPtr font;
+	const AssetPack* pack;
+
+};
+
+} //namespace phoenix
 #endif // __PHBITMAPFONTLDR_H__
\ No newline at end of file
@@ -1,479 +1,749 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-
-#ifndef __PHBATCHGEOMETRY_H__
-#define __PHBATCHGEOMETRY_H__
-
-#include <vector>
-#include "config.h"
-#include "Vertex.h"
-#include "Texture.h"
-#include "Rectangle.h"
-#include "TrackingInvariant.h"
-#include "BatchRenderer.h"
-#include "Droppable.h"
-#include <boost/foreach.hpp>
-#include <boost/function.hpp>
-#include <boost/noncopyable.hpp>
-
-namespace phoenix
-{
-
-// workaround for GCC 4.7 unqualified call issue
-using boost::intrusive_ptr;
-using boost::intrusive_ptr_add_ref;
-using boost::intrusive_ptr_release;
-
-class BatchGeometry;
-
-//! Friendly Batch Geometry Pointer
-typedef boost::intrusive_ptr<BatchGeometry> BatchGeometryPtr;
-
-//! Batch Geometry Class.
-/*
-	This class is used by the optimizing batch renderer to display geometry.
-	Users are able to overload this class and highly customize it. This class
-	is garbage collected and managed in very similar manner to Resource, but
-	it should be noted that they are only alike in that they are both Droppable().
-	Geometry is organized in the BatchRenderer by depth, group, texture id, and primitive type. 
-	Any changes to any of these properties must be followed by an update() call.
-*/
-class BatchGeometry
-    : public Droppable, boost::noncopyable
-{
-
-public:
-    //! Default Constructor
-    /*!
-        The geometry is automatically added to the given BatchRenderer.
-		\param _r The batch renderer that will display this geometry.
-		\param _p The primitive type.
-		\param _t The texture.
-		\param _g The group id.
-		\param _d The depth.
-    */
-	BatchGeometry(BatchRenderer& _r, unsigned int _p = GL_QUADS, TexturePtr _t = TexturePtr(), signed int _g = 0, float _d = 0.0f )
-		: Droppable(), renderer(_r), primitivetype(_p), textureid( _t ? _t->getTextureId() : 0 ), texture(_t), groupid(_g), depth(_d), enabled(true), vertices(), immediate(false), clip(false)
-	{
-		_r.add( this );
-	}
-
-	//! Create from Rectangle
-	/*!
-		Exactly like the regular constructor but also calls fromRectangle().
-	*/
-	BatchGeometry( BatchRenderer& _r, const Rectangle& _rect, TexturePtr _t = TexturePtr(), signed int _g = 0, float _d = 0.0f )
-        : Droppable(), renderer(_r), primitivetype( GL_QUADS ), textureid( _t ? _t->getTextureId() : 0 ), texture(_t), groupid(_g), depth(_d), enabled(true), vertices(), immediate(false), clip(false)
-	{
-		fromRectangle( _rect );
-		_r.add( this );
-	}
-
-	//! Create from Polygon
-	/*!
-		Exactly like the regular constructor but also calls fromPolygon().
-	*/
-	BatchGeometry( BatchRenderer& _r, const Polygon& _poly, TexturePtr _t = TexturePtr(), signed int _g = 0, float _d = 0.0f )
-        : Droppable(), renderer(_r), primitivetype( GL_TRIANGLES ), textureid( _t ? _t->getTextureId() : 0 ), texture(_t), groupid(_g), depth(_d), enabled(true), vertices(), immediate(false), clip(false)
-	{
-        fromPolygon( _poly );
-		_r.add( this );
-	}
-
-	/*!
-		Does nothing.
-		\sa drop()
-	*/
-	virtual ~BatchGeometry()
-	{
-	}
-
-    //! Grab
-	/*!
-		Grabs a pointer to this geometry. This is very akin to Resource::grab().
-	*/
-	template <typename T>
-    inline boost::intrusive_ptr<T> grab()
-    {
-        try
-        {
-            return boost::static_pointer_cast<T,BatchGeometry>( this );
-        }
-        catch ( ... )
-        {
-            return boost::intrusive_ptr<T>();
-        }
-    }
-
-	//! Drop
-	/*!
-		Drops this geometry from the renderer, and adds it to the garbage collection
-		list. The geometry should be considered deleted. Derived classes should
-		call this manually. This is very akin to Resource::drop().
-		\sa dropped(), grab(), Droppable::drop(), Resource::drop()
-	*/
-	inline virtual void drop()
-	{
-		if( ! dropped() )
-		{
-			renderer.remove( this );
-			Droppable::drop();
-		}
-	}
-
-	//! Get vertex
-	/*!
-		\note This function works like a ring buffer. this is to reduce the complexity of certain geometric algorithms. 
-	*/
-	inline const Vertex& getVertex(const signed int& a) const
-    {
-        return vertices[ a % vertices.size() ];
-    }
-
-	//! Set vertex.
-    /*!
-		\note This function acts like a ring buffer, this is to reduce the complexity of implementing some geometric algorithms.
-    */
-    inline void setVertex(const signed int& a, const Vertex& v)
-    {
-        vertices[ a % vertices.size() ] = v;
-    }
-
-
-	//! Add vertex.
-    inline void addVertex(const Vertex& a)
-    {
-        vertices.push_back(a);
-    }
-
-	//! Clear all vertices
-	inline void clear() { vertices.clear(); }
-
-	//! Remove vertex.
-	/*!
-		\note This function works like a ring buffer. this is to reduce the complexity of certain geometric algorithms. 
-	*/
-	inline void removeVertex( const signed int& a )
-	{
-		vertices.erase( vertices.begin() + (a % vertices.size()) );
-	}
-
-	//! The current number of vertices in the geometry.
-    inline const unsigned int getVertexCount() const
-    {
-        return vertices.size();
-    }
-
-	//! Array operator for vertices. (operates as a ring buffer).
-	inline Vertex& operator[] ( signed int _i ) { return vertices[ _i % vertices.size() ]; }
-
-	//! Returns the invariant for the Primitive Type (used by BatchRender).
-	inline TrackingInvariant< unsigned int >& getPrimitiveTypeInvariant() { return primitivetype; }
-
-	//! Returns the invariant for the Textured ID (used by BatchRender).
-	inline TrackingInvariant< unsigned int >& getTextureIdInvariant() { return textureid; }
-
-	//! Returns the invariant for the Group ID (used by BatchRender).
-	inline TrackingInvariant< signed int >& getGroupInvariant() { return groupid; }
-
-	//! Returns the invariant for the Depth (used by BatchRender).
-	inline TrackingInvariant< float >& getDepthInvariant() { return depth; }
-
-	//! Get the texture associated with this geometry.
-	inline TexturePtr getTexture() { return texture; }
-
-	//! Get the OpenGL Primitive Type associated with this geometry.
-	inline const unsigned int& getPrimitiveType() const { return primitivetype; }
-
-	//! Get the OpenGL Texture ID associated with this geometry.
-	inline const unsigned int& getTextureId() const { return textureid; }
-
-	//! Get the Group ID associated with this geometry.
-	inline const signed int& getGroup() const { return groupid; }
-
-	//! Get the Depth associated with this geometry.
-	inline float getDepth() const { return depth; }
-
-	//! Check if this geometry is enabled.
-	inline bool getEnabled() const { return enabled; }
-
-	//! Check if this geometry is immediate.
-	inline bool getImmediate() const { return immediate; }
-
-	//! Set OpenGL Primitive type.
-	/*
-		Sets OpenGL primitive type of this piece of geometry. It defaults to
-		GL_QUADS, but may be GL_TRIANGLES, GL_LINES, GL_POINTS, etc.
-		\see getPrimitiveType(), update()
-		\note update() must be called before this change will take effect!
-	*/
-	inline virtual void setPrimitiveType( const unsigned int& _v ) { primitivetype = _v; }
-
-	//! Set Texture.
-	/*!
-		Sets the texture for this geometry. If it is an invalid texture or empty
-		pointer, the Id is set to 0 to disable texturing for this geometry. 
-		\see getTexture(), getTextureId(), update()
-		\note update() must be called before this change will take effect!
-	*/
-	inline virtual void setTexture( TexturePtr _t ) 
-	{ 
-		texture = _t; 
-		textureid = _t ? _t->getTextureId() : 0 ;
-	}
-
-	//! Set Group Id.
-	/*
-		Sets the Group identifier of this geometry. Geometries of the same group usually have the same properties and
-		share render states that are set and unset via GroupStates in the BatchRenderer.
-		\see getGroup(), update(), BatchRender::addGroupState()
-		\note update() must be called before this change will take effect!
-	*/
-	inline virtual void setGroup( const signed int& _v ) { groupid = _v; }
-
-	//! Set Depth
-	/*!
-		Sets the rendering depth of this geometry.
-		\see getDepth(), update()
-		\note update() must be called before this change will take effect!
-	*/
-	inline virtual void setDepth( float _v ) { depth = _v; }
-
-	//! Enable or Disable.
-	/*!
-		Disabled geometry is skipped over during rendering.
-		\see getEnabled()
-	*/
-	inline virtual void setEnabled( bool _e ) { enabled = _e; }
-
-	//! Immediate rendering.
-	/*!
-		Immediate geometry is drawn once then dropped, so this is useful for non-persistent geometry. It's highly
-		suggested that you only use this when needed, as persistent geometry is much faster.
-		\see getImmediate(), drop()
-	*/
-	inline virtual void setImmediate( bool _i ) { immediate = _i; }
-
-	//! Enable or Disable Clipping
-	/*!
-		If enabled, the geometry will be clipped by the Rectangle provided to setClippingRectangle(). This will cause the geometry not to be batched with other geometry
-		of the same material. 
-	*/
-	inline virtual void setClipping( bool _c ){ clip = _c; }
-	inline bool getClipping(){ return clip; }
-
-	//! Set the Clipping Rectangle
-	inline virtual void setClippingRectangle( const Rectangle& _r ){ clip_rect = _r; }
-
-	//! Get the Clipping Rectangle
-	inline const Rectangle& getClippingRectangle() { return clip_rect; }
-
-	//! Update
-	/*!
-		This function will check all invariants and move the geometry's location in the renderer's graph
-		if any of them have been broken, and then resets all the invariants. This function should be called
-		after the depth, group, texture, or primitive type of this geometry is changed.
-	*/
-	virtual void update()
-	{
-		if( ! (primitivetype.check() && textureid.check() && groupid.check() && depth.check()) )
-		{
-			renderer.move( this );
-			primitivetype.reset();
-			textureid.reset();
-			groupid.reset();
-			depth.reset();
-		}
-	}
-
-	//! Batch
-	/*!
-		This function is called by BatchRenderer when it draws the current render
-		graph. The geometry should append all of it's vertices to the renderer's
-		list.
-		\param list The current vertex list from the current BatchRender.
-		\param persist If true, immediate geometry will not drop itself.
-	*/
-	virtual unsigned int batch( std::vector<Vertex>& list, bool persist = false )
-	{
-		if( immediate && !persist )
-		{
-			drop();
-		}
-
-		if( enabled )
-		{
-			if( ! vertices.empty() )
-			{
-                std::vector<Vertex>::iterator verticesend = vertices.end();
-                for( std::vector<Vertex>::iterator v = vertices.begin(); v != verticesend; ++v )
-					list.push_back( *v );
-			}
-			return 1;
-		}
-		return 0;
-	}
-
-	//! Combine with another
-	/*
-		Combines this geometry with another geometry by pushing the vertices of 
-		the other onto this one. This function does not perform any checks. It
-		assume you know what you're doing. 
-		\sa BatchGeometryComposite::combine
-	*/
-	virtual void combine( const BatchGeometryPtr& other, bool dropOther = true ) {
-		vertices.reserve(vertices.size() + other->vertices.size());
-		BOOST_FOREACH( Vertex& v, other->vertices ) {
-			vertices.push_back( v );
-		}
-
-		if( dropOther ) {
-			other->drop();
-		}
-	}
-
-	//! Translate
-	/*!
-		Adds the given vector to each vertex in the geometry, translating the geometery.
-		\f$ v_n = v_n + t \f$
-	*/
-	inline virtual void translate( const Vector2d& _t )
-	{
-		BOOST_FOREACH( Vertex& v, vertices )
-		{
-			v.position += _t;
-		}
-	}
-
-	//! Scale
-	/*!
-		Multiples every vertex in the geometry the given vector linearly.
-		\f$ v_n = ( v_{nx} + s_x , v_{ny} + s_y ) \f$
-	*/
-	inline virtual void scale( const Vector2d& _s )
-	{
-		BOOST_FOREACH( Vertex& v, vertices )
-		{
-			v.position.setX( v.position.getX() * _s.getX() );
-			v.position.setY( v.position.getY() * _s.getY() );
-		}
-	}
-
-	//! Rotate
-	/*!
-		Rotates each vertex by the given rotation matrix.
-		\f$ v_n = v_n * m \f$
-	*/
-	inline virtual void rotate( const RotationMatrix& _m )
-	{
-		BOOST_FOREACH( Vertex& v, vertices )
-		{
-			v.position *= _m;
-		}
-	}
-
-	//! Sets the color on all vertices.
-	inline virtual void colorize( const Color& _c )
-	{
-		BOOST_FOREACH( Vertex& v, vertices )
-		{
-			v.color = _c;
-		}
-	}
-
-	//! Define vertices using a Polygon.
-	/*!
-		Sets our vertices equal to the given Polygon. This is used by the polygon constructor.
-		\note No colors or texture coords are set.
-	*/
-	inline void fromPolygon ( const Polygon& rhs )
-	{
-		setPrimitiveType( GL_TRIANGLES ); //primive type must be triangles.
-		update();
-		vertices.clear();
-		//simple polygon to triangle expansion.
-		if( rhs.getVertexCount() > 2 )
-		{
-			for( signed int i = 0; i < (signed int)rhs.getVertexCount(); ++i )
-			{
-				vertices.push_back( rhs.getPosition() + rhs.getVertex(i+1) );
-                vertices.push_back( rhs.getPosition() + rhs.getVertex(i) );
-                vertices.push_back( rhs.getPosition() );
-			}
-		}
-	}
-
-	//! Define vertices using a Rectangle.
-	/*!
-		Sets our vertices equal to the given Rectangle. The type is set to GL_QUADS. 
-		The texture coordinates are automatically set to (0,0), (0,1), (1,1), (1,0). 
-		This is used by the Rectangle constructor.
-	*/
-	inline void fromRectangle( const Rectangle &rhs )
-	{
-		setPrimitiveType( GL_QUADS ); //primive type must be quads.
-		update();
-		vertices.clear();
-		vertices.push_back( Vertex( Vector2d(0,0), Color(), TextureCoords(0,0) ) );
-		vertices.push_back( Vertex( Vector2d(0, rhs.getSize().getY() ), Color(), TextureCoords(0,1) ) );
-		vertices.push_back( Vertex( rhs.getSize(), Color(), TextureCoords(1,1) ) );
-		vertices.push_back( Vertex( Vector2d( rhs.getSize().getX(), 0 ), Color(), TextureCoords(1,0) ) );
-		translate( rhs.getPosition() );
-	}
-
-protected:
-
-	//! Renderer
-	BatchRenderer& renderer;
-
-	//! Primitive type
-	/*
-		This is the OpenGL primitive type of this piece of geometry. It defaults to
-		GL_QUADS, but may be GL_TRIANGLES, GL_LINES, GL_POINTS, etc.
-	*/
-	TrackingInvariant<unsigned int> primitivetype;
-
-	//! Texture ID
-	/*
-		The invariant of the Texture's ID. This is 0 if this geometry has no texture.
-	*/
-	TrackingInvariant< unsigned > textureid;
-
-	//! Texture
-	TexturePtr texture;
-
-	//! Group ID.
-	TrackingInvariant< signed int > groupid;
-
-	//! Depth
-	TrackingInvariant< float > depth;
-
-	//! Enabled
-	bool enabled;
-
-	//! Vertices
-	std::vector< Vertex > vertices;
-
-	//! Immediate
-	/*
-		If geometry is immediate, it is dropped right after it is drawn, so it only stays for one frame.
-	*/
-	bool immediate;
-
-	//! Clipping
-	bool clip;
-
-	//! Clip rectangle
-	Rectangle clip_rect;
-};
-
-} //namespace phoniex
-
-#endif // __PHBATCHGEOMETRY_H__
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+
+#ifndef __PHBATCHGEOMETRY_H__
+#define __PHBATCHGEOMETRY_H__
+
+#include <vector>
+#include <algorithm>
+#include "config.h"
+#include "Vertex.h"
+#include "VertexList.h"
+#include "VertexTransform.h"
+#include "Texture.h"
+#include "Rectangle.h"
+#include "BatchRenderer.h"
+#include "Droppable.h"
+#include <boost/foreach.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+
+namespace phoenix
+{
+
+// workaround for GCC 4.7 unqualified call issue
+using boost::intrusive_ptr;
+using boost::intrusive_ptr_add_ref;
+using boost::intrusive_ptr_release;
+
+class BatchGeometry;
+
+//! Friendly Batch Geometry Pointer
+typedef boost::intrusive_ptr<BatchGeometry> BatchGeometryPtr;
+
+//! Batch Geometry Class.
+/*
+	This class is used by the optimizing batch renderer to display geometry.
+	Users are able to overload this class and highly customize it. This class
+	is garbage collected and managed in very similar manner to Resource, but
+	it should be noted that they are only alike in that they are both Droppable().
+	Geometry is organized in the BatchRenderer by depth, group, texture id, and primitive type. 
+	Any changes to any of these properties must be followed by an update() call.
+*/
+class BatchGeometry
+    : public Droppable, boost::noncopyable
+{
+
+public:
+    //! Default Constructor
+    /*!
+        The geometry is automatically added to the given BatchRenderer.
+		\param _r The batch renderer that will display this geometry.
+		\param _p The primitive type.
+		\param _t The texture.
+		\param _g The group id.
+		\param _d The depth.
+    */
+	BatchGeometry(BatchRenderer& _r, unsigned int _p = GL_QUADS, TexturePtr _t = TexturePtr(), signed int _g = 0, float _d = 0.0f )
+		: Droppable(), enabled(true), immediate(false), clip(false), transient(false), opaque(false), dirty(0), vertices(), renderer(_r), texture(_t),
+		primitivetype(_p), textureid( _t ? _t->getTextureId() : 0 ), groupid(_g), depth(_d), placed(), clip_rect(), xform()
+	{
+		settle();
+		_r.add( this );
+	}
+
+	//! Create from Rectangle
+	/*!
+		Exactly like the regular constructor but also calls fromRectangle().
+	*/
+	BatchGeometry( BatchRenderer& _r, const Rectangle& _rect, TexturePtr _t = TexturePtr(), signed int _g = 0, float _d = 0.0f )
+        : Droppable(), enabled(true), immediate(false), clip(false), transient(false), opaque(false), dirty(0), vertices(), renderer(_r), texture(_t),
+		primitivetype( GL_QUADS ), textureid( _t ? _t->getTextureId() : 0 ), groupid(_g), depth(_d), placed(), clip_rect(), xform()
+	{
+		settle();
+		fromRectangle( _rect );
+		_r.add( this );
+	}
+
+	//! Create from Polygon
+	/*!
+		Exactly like the regular constructor but also calls fromPolygon().
+	*/
+	BatchGeometry( BatchRenderer& _r, const Polygon& _poly, TexturePtr _t = TexturePtr(), signed int _g = 0, float _d = 0.0f )
+        : Droppable(), enabled(true), immediate(false), clip(false), transient(false), opaque(false), dirty(0), vertices(), renderer(_r), texture(_t),
+		primitivetype( GL_TRIANGLES ), textureid( _t ? _t->getTextureId() : 0 ), groupid(_g), depth(_d), placed(), clip_rect(), xform()
+	{
+		settle();
+        fromPolygon( _poly );
+		_r.add( this );
+	}
+
+	/*!
+		Does nothing.
+		\sa drop()
+	*/
+	virtual ~BatchGeometry()
+	{
+	}
+
+    //! Grab
+	/*!
+		Grabs a pointer to this geometry. This is very akin to Resource::grab().
+	*/
+	template <typename T>
+    inline boost::intrusive_ptr<T> grab()
+    {
+        try
+        {
+            return boost::static_pointer_cast<T,BatchGeometry>( this );
+        }
+        catch ( ... )
+        {
+            return boost::intrusive_ptr<T>();
+        }
+    }
+
+	//! Drop
+	/*!
+		Drops this geometry from the renderer, and adds it to the garbage collection
+		list. The geometry should be considered deleted. Derived classes should
+		call this manually. This is very akin to Resource::drop().
+		\sa dropped(), grab(), Droppable::drop(), Resource::drop()
+	*/
+	inline virtual void drop()
+	{
+		if( ! dropped() )
+		{
+			renderer.remove( this );
+			Droppable::drop();
+		}
+	}
+
+	//! Get vertex
+	/*!
+		\note This function works like a ring buffer. this is to reduce the complexity of certain geometric algorithms. 
+	*/
+	inline const Vertex& getVertex(const signed int& a) const
+    {
+        return vertices[ a % vertices.size() ];
+    }
+
+	//! Set vertex.
+    /*!
+		\note This function acts like a ring buffer, this is to reduce the complexity of implementing some geometric algorithms.
+    */
+    inline void setVertex(const signed int& a, const Vertex& v)
+    {
+        vertices[ a % vertices.size() ] = v;
+    }
+
+
+	//! Add vertex.
+    inline void addVertex(const Vertex& a)
+    {
+        vertices.push_back(a);
+    }
+
+	//! Clear all vertices
+	inline void clear() { vertices.clear(); }
+
+	//! Remove vertex.
+	/*!
+		\note This function works like a ring buffer. this is to reduce the complexity of certain geometric algorithms. 
+	*/
+	inline void removeVertex( const signed int& a )
+	{
+		vertices.erase( vertices.begin() + (a % vertices.size()) );
+	}
+
+	//! The current number of vertices in the geometry.
+    inline const unsigned int getVertexCount() const
+    {
+        return vertices.size();
+    }
+
+	//! Gets what the geometry is ordered by in a Y sorted layer, the bottom of its bounding box as it's drawn.
+	/*!
+		\sa BatchRenderer::setLayerSort()
+	*/
+	virtual float getSortY() const
+	{
+		if( vertices.empty() ) return 0.0f;
+		const AffineTransform& a = xform ? xform->world : AffineTransform();
+		float bottom = a.c * vertices[0].position.getX() + a.d * vertices[0].position.getY() + a.ty;
+		for( unsigned int i = 1; i < vertices.size(); ++i )
+		{
+			const float y = a.c * vertices[i].position.getX() + a.d * vertices[i].position.getY() + a.ty;
+			if( y > bottom ) bottom = y;
+		}
+		return bottom;
+	}
+
+	//! Array operator for vertices. (operates as a ring buffer).
+	inline Vertex& operator[] ( signed int _i ) { return vertices[ _i % vertices.size() ]; }
+
+	//! Where geometry is filed in the renderer's graph.
+	struct Key
+	{
+		float depth;
+		signed int group;
+		unsigned int texture;
+		unsigned int primitive;
+		bool opaque;
+	};
+
+	//! Returns the key this geometry was last filed under (used by BatchRender).
+	inline const Key& getPlacedKey() const { return placed; }
+
+	//! Checks if the depth, group, texture, primitive type, or opacity changed since the last update().
+	inline bool getDirty() const { return dirty != 0; }
+
+	//! Get the texture associated with this geometry.
+	inline TexturePtr getTexture() { return texture; }
+
+	//! Get the OpenGL Primitive Type associated with this geometry.
+	inline unsigned int getPrimitiveType() const { return primitivetype; }
+
+	//! Get the OpenGL Texture ID associated with this geometry.
+	inline unsigned int getTextureId() const { return textureid; }
+
+	//! Get the Group ID associated with this geometry.
+	inline signed int getGroup() const { return groupid; }
+
+	//! Get the Depth associated with this geometry.
+	inline float getDepth() const { return depth; }
+
+	//! Check if this geometry is enabled.
+	inline bool getEnabled() const { return enabled; }
+
+	//! Check if this geometry is immediate.
+	inline bool getImmediate() const { return immediate; }
+
+	//! Check if this geometry belongs to the renderer's per-frame arena.
+	/*!
+		\sa BatchRenderer::createImmediate()
+	*/
+	inline bool getTransient() const { return transient; }
+
+	//! Set OpenGL Primitive type.
+	/*
+		Sets OpenGL primitive type of this piece of geometry. It defaults to
+		GL_QUADS, but may be GL_TRIANGLES, GL_LINES, GL_POINTS, etc.
+		\see getPrimitiveType(), update()
+		\note update() must be called before this change will take effect!
+	*/
+	inline virtual void setPrimitiveType( const unsigned int& _v ) { track( primitivetype, placed.primitive, _v, DIRTY_PRIMITIVE ); }
+
+	//! Set Texture.
+	/*!
+		Sets the texture for this geometry. If it is an invalid texture or empty
+		pointer, the Id is set to 0 to disable texturing for this geometry. 
+		\see getTexture(), getTextureId(), update()
+		\note update() must be called before this change will take effect!
+	*/
+	inline virtual void setTexture( TexturePtr _t ) 
+	{ 
+		texture = _t; 
+		track( textureid, placed.texture, _t ? _t->getTextureId() : 0, DIRTY_TEXTURE );
+	}
+
+	//! Set Group Id.
+	/*
+		Sets the Group identifier of this geometry. Geometries of the same group usually have the same properties and
+		share render states that are set and unset via GroupStates in the BatchRenderer.
+		\see getGroup(), update(), BatchRender::addGroupState()
+		\note update() must be called before this change will take effect!
+	*/
+	inline virtual void setGroup( const signed int& _v ) { track( groupid, placed.group, _v, DIRTY_GROUP ); }
+
+	//! Set Depth
+	/*!
+		Sets the rendering depth of this geometry.
+		\see getDepth(), update()
+		\note update() must be called before this change will take effect!
+	*/
+	inline virtual void setDepth( float _v ) { track( depth, placed.depth, _v, DIRTY_DEPTH ); }
+
+	//! Set Opaque
+	/*!
+		Opaque geometry has no translucent pixels, so when the renderer's opaque pass is on it's drawn first,
+		sorted by group, texture, and primitive type regardless of depth, and the depth buffer keeps it in order.
+		Geometry isn't opaque unless it's set to be.
+		\see getOpaque(), update(), BatchRenderer::setOpaquePass(), Texture::getOpaque()
+		\note update() must be called before this change will take effect!
+	*/
+	inline virtual void setOpaque( bool _o )
+	{
+		opaque = _o;
+		if( _o != placed.opaque ) dirty |= DIRTY_OPAQUE;
+		else dirty &= ~DIRTY_OPAQUE;
+	}
+
+	//! Checks if the geometry is opaque.
+	inline bool getOpaque() const { return opaque; }
+
+	//! Enable or Disable.
+	/*!
+		Disabled geometry is skipped over during rendering.
+		\see getEnabled()
+	*/
+	inline virtual void setEnabled( bool _e ) { enabled = _e; }
+
+	//! Immediate rendering.
+	/*!
+		Immediate geometry is drawn once then dropped, so this is useful for non-persistent geometry. It's highly
+		suggested that you only use this when needed, as persistent geometry is much faster.
+		\see getImmediate(), drop()
+	*/
+	inline virtual void setImmediate( bool _i ) { immediate = _i; }
+
+	//! Enable or Disable Clipping
+	/*!
+		If enabled, the geometry will be clipped by the Rectangle provided to setClippingRectangle(). This will cause the geometry not to be batched with other geometry
+		of the same material. 
+	*/
+	inline virtual void setClipping( bool _c ){ clip = _c; }
+	inline bool getClipping(){ return clip; }
+
+	//! Set the Clipping Rectangle
+	inline virtual void setClippingRectangle( const Rectangle& _r )
+	{
+		if( clip_rect ) *clip_rect = _r;
+		else clip_rect.reset( new Rectangle( _r ) );
+	}
+
+	//! Get the Clipping Rectangle
+	inline const Rectangle& getClippingRectangle()
+	{
+		static const Rectangle none;
+		return clip_rect ? *clip_rect : none;
+	}
+
+	//! Update
+	/*!
+		This function will move the geometry's location in the renderer's graph if its depth, group,
+		texture, or primitive type changed since it was last filed. This function should be called
+		after the depth, group, texture, or primitive type of this geometry is changed.
+	*/
+	virtual void update()
+	{
+		if( dirty )
+		{
+			renderer.move( this );
+			settle();
+		}
+	}
+
+	//! Gets the number of vertices batchInto() will write.
+	virtual unsigned int getBatchSize() const
+	{
+		return enabled ? vertices.size() : 0;
+	}
+
+	//! Batch into a span
+	/*!
+		Writes all of the geometry's vertices into storage the caller has already sized, such
+		as a mapped buffer. This function is called by BatchRenderer when it draws the current
+		render graph, geometry that makes its own vertices should override it and getBatchSize().
+		\param out Where to write, with room for at least getBatchSize() vertices.
+		\param persist If true, immediate geometry will not drop itself.
+		\return The number of vertices written.
+	*/
+	virtual unsigned int batchInto( Vertex* out, bool persist = false )
+	{
+		if( immediate && !persist )
+		{
+			drop();
+		}
+
+		const unsigned int n = getBatchSize();
+		if( n )
+		{
+			std::copy( vertices.begin(), vertices.end(), out );
+			if( xform ) transformVertices( out, n, xform->world );
+		}
+		return n;
+	}
+
+	//! Combine with another
+	/*
+		Combines this geometry with another geometry by pushing the vertices of 
+		the other onto this one. This function does not perform any checks. It
+		assume you know what you're doing. 
+		\sa BatchGeometryComposite::combine
+	*/
+	virtual void combine( const BatchGeometryPtr& other, bool dropOther = true ) {
+		unsigned int start = vertices.size();
+		vertices.reserve(vertices.size() + other->vertices.size());
+		BOOST_FOREACH( Vertex& v, other->vertices ) {
+			vertices.push_back( v );
+		}
+		if( other->xform ) transformVertices( vertices.begin() + start, vertices.size() - start, other->xform->world );
+
+		if( dropOther ) {
+			other->drop();
+		}
+	}
+
+	//! Translate
+	/*!
+		Adds the given vector to each vertex in the geometry, translating the geometery.
+		\f$ v_n = v_n + t \f$
+	*/
+	inline virtual void translate( const Vector2d& _t )
+	{
+		translateVertices( vertices.begin(), vertices.size(), _t );
+	}
+
+	//! Scale
+	/*!
+		Multiples every vertex in the geometry the given vector linearly.
+		\f$ v_n = ( v_{nx} + s_x , v_{ny} + s_y ) \f$
+	*/
+	inline virtual void scale( const Vector2d& _s )
+	{
+		scaleVertices( vertices.begin(), vertices.size(), _s );
+	}
+
+	//! Rotate
+	/*!
+		Rotates each vertex by the given rotation matrix.
+		\f$ v_n = v_n * m \f$
+	*/
+	inline virtual void rotate( const RotationMatrix& _m )
+	{
+		rotateVertices( vertices.begin(), vertices.size(), _m );
+	}
+
+	//! Transform
+	/*!
+		Scales, rotates, and then translates each vertex, in one pass over the vertices.
+		\f$ v_n = ( ( v_{nx} * s_x , v_{ny} * s_y ) * m ) + t \f$
+		\sa scale(), rotate(), translate()
+	*/
+	inline virtual void transform( const Vector2d& _s, const RotationMatrix& _m, const Vector2d& _t )
+	{
+		transformVertices( vertices.begin(), vertices.size(), _s, _m, _t );
+	}
+
+	//! Sets the color on all vertices.
+	inline virtual void colorize( const Color& _c )
+	{
+		colorizeVertices( vertices.begin(), vertices.size(), _c );
+	}
+
+	//! Set the deferred transform.
+	/*!
+		Unlike translate(), rotate(), and scale(), this doesn't touch the vertices. They are scaled and rotated
+		about _origin, and then _origin is moved to _position, as they're written out in batchInto(). So moving,
+		spinning, or scaling geometry each frame costs the same no matter how many vertices it has. The
+		vertices (and getVertex()) stay in the untransformed space.
+		\param _position Where the origin ends up.
+		\param _rotation Rotation about the origin.
+		\param _scale Scale about the origin.
+		\param _origin The point that is rotated and scaled about, in vertex space.
+		\sa setTransformPosition(), clearTransform(), getWorldTransform()
+	*/
+	inline void setTransform( const Vector2d& _position, const RotationMatrix& _rotation = RotationMatrix(), const Vector2d& _scale = Vector2d(1,1), const Vector2d& _origin = Vector2d(0,0) )
+	{
+		Transform& t = getXform();
+		t.position = _position;
+		t.rotation = _rotation;
+		t.scale = _scale;
+		t.origin = _origin;
+		updateTransform();
+	}
+
+	//! Moves the deferred transform's origin to _p.
+	inline void setTransformPosition( const Vector2d& _p )
+	{
+		getXform().position = _p;
+		updateTransform();
+	}
+
+	//! Sets the deferred transform's rotation.
+	inline void setTransformRotation( const RotationMatrix& _m )
+	{
+		getXform().rotation = _m;
+		updateTransform();
+	}
+
+	//! Sets the deferred transform's scale.
+	inline void setTransformScale( const Vector2d& _s )
+	{
+		getXform().scale = _s;
+		updateTransform();
+	}
+
+	//! Sets the deferred transform's origin.
+	inline void setTransformOrigin( const Vector2d& _o )
+	{
+		getXform().origin = _o;
+		updateTransform();
+	}
+
+	//! Gets the deferred transform's position.
+	inline const Vector2d getTransformPosition() const { return xform ? xform->position : Vector2d(0,0); }
+
+	//! Gets the deferred transform's rotation.
+	inline const RotationMatrix getTransformRotation() const { return xform ? xform->rotation : RotationMatrix(); }
+
+	//! Gets the deferred transform's scale.
+	inline const Vector2d getTransformScale() const { return xform ? xform->scale : Vector2d(1,1); }
+
+	//! Gets the deferred transform's origin.
+	inline const Vector2d getTransformOrigin() const { return xform ? xform->origin : Vector2d(0,0); }
+
+	//! Checks if this geometry has a deferred transform.
+	inline bool hasTransform() const { return xform.get() != 0; }
+
+	//! Gets what batchInto() applies to the vertices, this geometry's transform after its parent's.
+	inline const AffineTransform getWorldTransform() const { return xform ? xform->world : AffineTransform(); }
+
+	//! Removes the deferred transform (and the parent's), the vertices are drawn as they are.
+	inline void clearTransform()
+	{
+		xform.reset();
+		transformChanged();
+	}
+
+	//! Sets the parent's world transform, which is applied after this geometry's own (used by BatchGeometryComposite).
+	inline void setParentTransform( const AffineTransform& _a )
+	{
+		getXform().parent = _a;
+		updateTransform();
+	}
+
+	//! Takes away the parent's world transform, which is done when this is taken out of a BatchGeometryComposite.
+	inline void clearParentTransform()
+	{
+		if( ! xform ) return;
+		xform->parent = AffineTransform();
+		updateTransform();
+	}
+
+	//! Define vertices using a Polygon.
+	/*!
+		Sets our vertices equal to the given Polygon. This is used by the polygon constructor.
+		\note No colors or texture coords are set.
+	*/
+	inline void fromPolygon ( const Polygon& rhs )
+	{
+		setPrimitiveType( GL_TRIANGLES ); //primive type must be triangles.
+		update();
+		vertices.clear();
+		//simple polygon to triangle expansion.
+		if( rhs.getVertexCount() > 2 )
+		{
+			for( signed int i = 0; i < (signed int)rhs.getVertexCount(); ++i )
+			{
+				vertices.push_back( rhs.getPosition() + rhs.getVertex(i+1) );
+                vertices.push_back( rhs.getPosition() + rhs.getVertex(i) );
+                vertices.push_back( rhs.getPosition() );
+			}
+		}
+	}
+
+	//! Define vertices using a Rectangle.
+	/*!
+		Sets our vertices equal to the given Rectangle. The type is set to GL_QUADS. 
+		The texture coordinates are automatically set to (0,0), (0,1), (1,1), (1,0). 
+		This is used by the Rectangle constructor.
+	*/
+	inline void fromRectangle( const Rectangle &rhs )
+	{
+		setPrimitiveType( GL_QUADS ); //primive type must be quads.
+		update();
+		vertices.clear();
+		vertices.push_back( Vertex( Vector2d(0,0), Color(), TextureCoords(0,0) ) );
+		vertices.push_back( Vertex( Vector2d(0, rhs.getSize().getY() ), Color(), TextureCoords(0,1) ) );
+		vertices.push_back( Vertex( rhs.getSize(), Color(), TextureCoords(1,1) ) );
+		vertices.push_back( Vertex( Vector2d( rhs.getSize().getX(), 0 ), Color(), TextureCoords(1,0) ) );
+		translate( rhs.getPosition() );
+	}
+
+protected:
+
+	friend class BatchRenderer;
+
+	//! Arena constructor
+	/*!
+		Makes immediate geometry for the renderer's arena, it isn't added to the renderer here.
+		\sa BatchRenderer::createImmediate()
+	*/
+	BatchGeometry( BatchRenderer& _r, unsigned int _p, TexturePtr _t, signed int _g, float _d, bool _o, bool _transient )
+		: Droppable(), enabled(true), immediate(true), clip(false), transient(_transient), opaque(_o), dirty(0), vertices(), renderer(_r), texture(_t),
+		primitivetype(_p), textureid( _t ? _t->getTextureId() : 0 ), groupid(_g), depth(_d), placed(), clip_rect(), xform()
+	{
+		settle();
+	}
+
+	//! Makes arena geometry like new again, keeping the storage for its vertices.
+	void recycle( unsigned int _p, TexturePtr _t, signed int _g, float _d, bool _o )
+	{
+		revive();
+		primitivetype = _p;
+		texture = _t;
+		textureid = _t ? _t->getTextureId() : 0;
+		groupid = _g;
+		depth = _d;
+		opaque = _o;
+		settle();
+		enabled = true;
+		vertices.clear();
+		immediate = true;
+		clip = false;
+		xform.reset();
+	}
+
+	//! Bits of the graph key that changed since the last update().
+	enum E_DIRTY
+	{
+		DIRTY_PRIMITIVE = 1,
+		DIRTY_TEXTURE = 2,
+		DIRTY_GROUP = 4,
+		DIRTY_DEPTH = 8,
+		DIRTY_OPAQUE = 16
+	};
+
+	//! Sets part of the graph key, marking it dirty if it's no longer what the renderer has.
+	template< class T >
+	inline void track( T& _value, const T& _placed, const T& _v, unsigned char _bit )
+	{
+		_value = _v;
+		if( _v != _placed ) dirty |= _bit;
+		else dirty &= ~_bit;
+	}
+
+	//! Accepts the current depth, group, texture, primitive type, and opacity as the ones the renderer has.
+	inline void settle()
+	{
+		placed.depth = depth;
+		placed.group = groupid;
+		placed.texture = textureid;
+		placed.primitive = primitivetype;
+		placed.opaque = opaque;
+		dirty = 0;
+	}
+
+	/*
+		Members are in two parts, first the ones BatchRenderer::draw() looks at for every piece of geometry
+		(they pack in right after Droppable's), then the rest.
+	*/
+
+	//! Enabled
+	bool enabled : 1;
+
+	//! Immediate
+	/*
+		If geometry is immediate, it is dropped right after it is drawn, so it only stays for one frame.
+	*/
+	bool immediate : 1;
+
+	//! Clipping
+	bool clip : 1;
+
+	//! Allocated from the renderer's arena
+	bool transient : 1;
+
+	//! Opaque, see setOpaque().
+	bool opaque : 1;
+
+	//! Which parts of the graph key changed since the last update() (E_DIRTY bits).
+	unsigned char dirty;
+
+	//! Vertices, small geometry keeps them inline.
+	VertexList vertices;
+
+	//! Renderer
+	BatchRenderer& renderer;
+
+	//! Texture
+	TexturePtr texture;
+
+	//! Primitive type
+	/*
+		This is the OpenGL primitive type of this piece of geometry. It defaults to
+		GL_QUADS, but may be GL_TRIANGLES, GL_LINES, GL_POINTS, etc.
+	*/
+	unsigned int primitivetype;
+
+	//! Texture ID
+	/*
+		The Texture's ID. This is 0 if this geometry has no texture.
+	*/
+	unsigned int textureid;
+
+	//! Group ID.
+	signed int groupid;
+
+	//! Depth
+	float depth;
+
+	//! The key the renderer has this geometry filed under.
+	Key placed;
+
+	//! Clip rectangle, only made once it's set.
+	boost::scoped_ptr< Rectangle > clip_rect;
+
+	//! Deferred transform, see setTransform().
+	struct Transform
+	{
+		Vector2d position;
+		RotationMatrix rotation;
+		Vector2d scale;
+		Vector2d origin;
+
+		//! The parent composite's world transform.
+		AffineTransform parent;
+
+		//! parent * our own, what's applied in batchInto().
+		AffineTransform world;
+	};
+
+	//! Deferred transform, only made once one is set.
+	boost::scoped_ptr< Transform > xform;
+
+	//! Makes the deferred transform if there isn't one yet.
+	inline Transform& getXform()
+	{
+		if( ! xform )
+		{
+			xform.reset( new Transform );
+			xform->scale = Vector2d( 1, 1 );
+		}
+		return *xform;
+	}
+
+	//! Recomputes the world transform after a change.
+	inline void updateTransform()
+	{
+		xform->world = xform->parent * AffineTransform::fromParts( xform->position, xform->rotation, xform->scale, xform->origin );
+		transformChanged();
+	}
+
+	//! Called after the world transform changes, BatchGeometryComposite passes it on to its children.
+	inline virtual void transformChanged() {}
+};
+
+} //namespace phoniex
+
+#endif // __PHBATCHGEOMETRY_H__
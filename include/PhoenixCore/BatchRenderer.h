@@ -1,212 +1,505 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-
-#ifndef __PH_BATCH_RENDERER_H__
-#define __PH_BATCH_RENDERER_H__
-
-#include <map>
-#include <vector>
-#include <iostream>
-#include <boost/unordered_map.hpp>
-#include <boost/thread.hpp>
-#include "config.h"
-#include "Shader.h"
-#include "AbstractGarbageCollector.h"
-#include "View.h"
-#include "Droppable.h"
-#include "GroupState.h"
-#include "Vertex.h"
-#include "Rectangle.h"
-#include "RenderTarget.h"
-
-namespace phoenix
-{
-
-// workaround for GCC 4.7 unqualified call issue
-using boost::intrusive_ptr;
-using boost::intrusive_ptr_add_ref;
-using boost::intrusive_ptr_release;
-
-class BatchGeometry;
-
-//! Optimizing Batch Renderer.
-/*!
-	The Optimizing Batch Renderer is the soul of phoenix's rendering framework. All drawing calls 
-	go through the batching renderer. The main purpose of the batching renderer is to store all geometry 
-	and draw it at once, performing as many optimizations as possible. This adds a slight layer of complexity, 
-	but the speed tradeoff is well worth it. BatchGeometry is automatically sorted in a graph based on
-	depth, group, texture, and primitive type (in that order).
-*/
-class BatchRenderer
-	: public AbstractGarbageCollector
-{
-
-public:
-
-	//! Constructor
-	/*!
-		Initializes the geometry graph and starts the garbage collection routines.
-	*/
-	BatchRenderer( )
-		: AbstractGarbageCollector(), geometry(), recyclelist(), groupstates(), shader(), target(), clear_color(0,0,0), enable_clear(false),persist_immediate(false)
-	{
-		//collect fast.
-		setSleepTime( 5 );
-        setCollectionRate( 2 );
-	}
-
-	//! Destructor
-	/*!
-		Releases all references to geometry. 
-	*/
-	virtual ~BatchRenderer()
-	{
-		clear(); //drop all geometry.
-	}
-
-	//! Add geometry to the render graph. (Automatically called by BatchGeometry::create() ).
-	void add( boost::intrusive_ptr<BatchGeometry> _g );
-
-	//! Add geometry to the recycle list. ( Automatically called by BatchGeometry::drop() ).
-	void remove( boost::intrusive_ptr<BatchGeometry> _g );
-
-	//! Update a geometry's position in the graph. ( Automatically called by BatchGeometry::update() ).
-	void move( boost::intrusive_ptr<BatchGeometry> _g );
-
-	//! Drops all geometry.
-	void clear()
-	{
-		lock();
-		recyclelist.clear();
-		geometry.clear();
-		unlock();
-	}
-
-	//! Counts all the geometry in the list (may be slow). 
-	unsigned int count();
-
-    //! Cleaning routine
-	void clean();
-
-	//! Sets the group state for a given group id.
-	inline void addGroupState( const signed int _id, GroupStatePtr _gs ){
-		groupstates[_id] = _gs; 
-	}
-
-	//! Removes the group state for the given group id.
-	inline void removeGroupState( const signed int _id ){
-		groupstates.erase( _id );
-	}
-
-	//! Gets the group state for the given group id.
-	inline GroupStatePtr getGroupState( const signed int _id ){
-		return groupstates[_id];
-	}
-
-    //! Sets the renderer's view.
-    inline void setView( const View& other ) { view = other; }
-
-    //! Gets a reference to the renderer's view.
-    inline View& getView() { return view; }
-
-	//! Sets the renderer's target, if an empty pointer, the target is the window's framebuffer
-    inline void setRenderTarget( RenderTargetPtr _t = RenderTargetPtr() ) { target = _t; }
-
-    //! Gets a reference to the renderer's view.
-    inline RenderTargetPtr getRenderTarget() {return target; }
-
-	//! Sets the renderer's shader. If an empty pointer, the renderer will use the FFP
-	inline void setShader( ShaderPtr _s ) { shader = _s; }
-
-	//! Get the renderer's shader.
-	inline ShaderPtr getShader(){ return shader; }
-
-	//! Draws everything in the graph.
-	/*
-		\param pesist_immediate If set to true, immediate geometry will persist until the next time draw() is called, this is useful for RTT.
-	*/
-	void draw( bool _persist_immediate = false );
-
-	//! Draws a single geometry immediately
-	/*!
-		Automatically activates any attached rendertarget, and deactivates it before returning.
-	*/
-	void drawImmediately(  boost::intrusive_ptr<BatchGeometry> geom );
-
-	//! Clears the screen to the given color. Does not activate the current render target.
-    inline static void clearScreen( const Color& _c = Color(0,0,0) )
-    {
-        glClearColor( _c.getRed()/255.0f,_c.getGreen()/255.0f,_c.getBlue()/255.0f,_c.getAlpha()/255.0f );
-        glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
-    }
-
-	//! Get the default clear color
-    inline const Color& getClearColor() { return clear_color; }
-
-    //! Set the default clear color
-    inline void setClearColor(const Color& c) { clear_color = c; }
-
-	//! Enable/disable clearing (disabled by default, except for the rendersystem's batcher).
-	inline void setClearing( bool c ){ enable_clear = c; }
-
-#ifdef DEBUG_BATCHRENDERER
-	//! Lists all the geometry in the list.
-	void listGeometry();
-#endif
-
-private:
-
-	typedef std::list< boost::intrusive_ptr<BatchGeometry> > GEOMCONTAINER;
-	typedef boost::unordered_map< unsigned int, GEOMCONTAINER > BATCHMAPALPHA; // Primitive Keyed
-	typedef boost::unordered_map< unsigned int, BATCHMAPALPHA > BATCHMAPBETA; // Texture Keyed
-	typedef boost::unordered_map< signed int, BATCHMAPBETA > BATCHMAPGAMMA; // Group Keyed
-	typedef std::map< float, BATCHMAPGAMMA > BATCHMAPDELTA; // Depth Keyed (Ordered)
-
-	//! Geometry List Container.
-	BATCHMAPDELTA geometry;
-
-	//! Recycle list
-	std::vector< boost::intrusive_ptr<BatchGeometry> > recyclelist;
-
-	typedef boost::unordered_map< signed int, boost::shared_ptr<GroupState> > GROUPSTATEMAP;
-	//! Map of group states.
-	GROUPSTATEMAP groupstates;
-
-    //! View
-    View view;
-
-	//! Current shader
-	ShaderPtr shader;
-
-	//! Current render target
-	RenderTargetPtr target;
-
-	//! GL clear color
-    Color clear_color;
-	bool enable_clear;
-
-	//! Immediate persistence
-	bool persist_immediate;
-
-	//! Real removal routine ( used by clean() and move() ).
-	void removeProper( boost::intrusive_ptr<BatchGeometry> _g , bool _inv = false);
-
-	//! Clipping Routine
-	bool clipGeometry(  boost::intrusive_ptr<BatchGeometry> geom, bool &clipping, phoenix::Rectangle &clipping_rect );
-
-	//! Vertex submission routine.
-	void submitVertexList( std::vector< Vertex >& vlist, unsigned int type );
-};
-
-} //namespace phoenix
-
-#include "BatchGeometry.h"
-
-#endif //__PH_BATCH_RENDERER_H__
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+
+#ifndef __PH_BATCH_RENDERER_H__
+#define __PH_BATCH_RENDERER_H__
+
+#include <map>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <boost/unordered_map.hpp>
+#include <boost/thread.hpp>
+#include "config.h"
+#include "Shader.h"
+#include "AbstractGarbageCollector.h"
+#include "View.h"
+#include "Droppable.h"
+#include "GroupState.h"
+#include "Vertex.h"
+#include "Rectangle.h"
+#include "RenderTarget.h"
+
+namespace phoenix
+{
+
+// workaround for GCC 4.7 unqualified call issue
+using boost::intrusive_ptr;
+using boost::intrusive_ptr_add_ref;
+using boost::intrusive_ptr_release;
+
+class BatchGeometry;
+
+//! How geometry in a depth layer is ordered.
+enum E_LAYER_SORT {
+	ELS_STATE, //!< By group, texture, and primitive type, for the fewest state changes. (default)
+	ELS_Y //!< By the bottom of each piece's bounding box, so lower things are drawn over higher things.
+};
+
+//! Optimizing Batch Renderer.
+/*!
+	The Optimizing Batch Renderer is the soul of phoenix's rendering framework. All drawing calls 
+	go through the batching renderer. The main purpose of the batching renderer is to store all geometry 
+	and draw it at once, performing as many optimizations as possible. This adds a slight layer of complexity, 
+	but the speed tradeoff is well worth it. BatchGeometry is automatically sorted in a graph based on
+	depth, group, texture, and primitive type (in that order).
+
+	When the opaque pass is on (see setOpaquePass()), opaque geometry is kept in a second graph of just group,
+	texture, and primitive type, and drawn before everything else. Every vertex's z is set from its geometry's
+	depth so that the depth buffer, rather than the drawing order, keeps opaque geometry behind whatever has a
+	higher depth. Translucent geometry is drawn afterwards by depth as usual.
+
+	Immediate geometry made by createImmediate() (which GraphicsFactory2d uses) comes from a per-frame arena.
+	It is kept in a separate transient list in its bucket of the graph, and after draw() the transient lists
+	are emptied and the arena reset all at once, so it never goes through the recycle list or garbage collection
+	and its storage is reused the next frame.
+
+	Layers can be Y sorted instead (see setLayerSort()) for isometric and top down scenes. Their geometry is
+	drawn in order of BatchGeometry::getSortY(), which is worked out again each frame, so moving things doesn't
+	need update(). The order is kept from frame to frame and fixed with an insertion sort, which only has to
+	move what moved past its neighbors.
+*/
+class BatchRenderer
+	: public AbstractGarbageCollector
+{
+
+public:
+
+	//! Constructor
+	/*!
+		Initializes the geometry graph and starts the garbage collection routines.
+	*/
+	BatchRenderer( )
+		: AbstractGarbageCollector(), geometry(), recyclelist(), arena(), arena_used(0), vlist(), clip_vlist(), sorted_layers(), opaque_geometry(), opaque_pass(false), layer_step(0), layer_min(0), layer_count(0), depth_counts(), groupstates(), active_state(), active_group(0), group_switches(0), elided_group_switches(0), shader(), target(), clear_color(0,0,0), enable_clear(false),persist_immediate(false)
+	{
+		//collect fast.
+		setSleepTime( 5 );
+        setCollectionRate( 2 );
+	}
+
+	//! Destructor
+	/*!
+		Releases all references to geometry. 
+	*/
+	virtual ~BatchRenderer()
+	{
+		clear(); //drop all geometry.
+	}
+
+	//! Add geometry to the render graph. (Automatically called by BatchGeometry::create() ).
+	void add( boost::intrusive_ptr<BatchGeometry> _g );
+
+	//! Makes immediate geometry from the per-frame arena and adds it to the render graph.
+	/*!
+		The geometry is only good until the end of the next draw(). If it is made non-immediate
+		before then, it's kept like any other geometry.
+		\param _p The primitive type.
+		\param _t The texture.
+		\param _g The group id.
+		\param _d The depth.
+		\param _o If the geometry is opaque.
+	*/
+	boost::intrusive_ptr<BatchGeometry> createImmediate( unsigned int _p = GL_QUADS, TexturePtr _t = TexturePtr(), signed int _g = 0, float _d = 0.0f, bool _o = false );
+
+	//! Gets the number of geometry objects in the arena, in use or not.
+	inline unsigned int getArenaSize() const { return arena.size(); }
+
+	//! Gets the number of arena geometry objects in use this frame.
+	inline unsigned int getArenaUsed() const { return arena_used; }
+
+	//! Add geometry to the recycle list. ( Automatically called by BatchGeometry::drop() ).
+	void remove( boost::intrusive_ptr<BatchGeometry> _g );
+
+	//! Update a geometry's position in the graph. ( Automatically called by BatchGeometry::update() ).
+	void move( boost::intrusive_ptr<BatchGeometry> _g );
+
+	//! Drops all geometry.
+	void clear()
+	{
+		lock();
+		recyclelist.clear();
+		geometry.clear();
+		opaque_geometry.clear();
+		for( SORTEDLAYERMAP::iterator sortedpair = sorted_layers.begin(); sortedpair != sorted_layers.end(); ++sortedpair ){
+			sortedpair->second.entries.clear();
+			sortedpair->second.changed = true;
+		}
+		arena.clear();
+		arena_used = 0;
+		depth_counts.clear();
+		unlock();
+	}
+
+	//! Counts all the geometry in the list (may be slow). 
+	unsigned int count();
+
+	//! Draws opaque geometry first, sorted for state changes instead of depth.
+	/*!
+		Opaque geometry (see BatchGeometry::setOpaque()) is drawn before anything else, batched across all depths
+		by group, texture, and primitive type. The z of every vertex drawn is set to -depth (of its layer, see
+		getLayerDepth()), so this needs the depth test on (RenderSystem turns it on) and depths inside the
+		projection's range of -1000 to 1000. It's off by default, which draws everything by depth and leaves z alone.
+
+		Render targets don't have a depth buffer, so while one is set (and in builds with DISABLE_DEPTHBUFFER)
+		the opaque pass isn't used and everything is drawn by depth. Opaque geometry in Y sorted layers is
+		kept in its layer, so it's sorted along with everything else.
+		\sa usingOpaquePass(), setLayerSort()
+	*/
+	void setOpaquePass( bool _o );
+
+	//! Checks if the opaque pass is on.
+	inline bool getOpaquePass() const { return opaque_pass; }
+
+	//! Checks if the opaque pass is on and can be used with the current render target.
+	bool usingOpaquePass() const;
+
+	//! Sets how the layer with _depth in it is ordered.
+	/*!
+		With ELS_Y, the layer is drawn in order of each piece of geometry's getSortY() rather than by group and
+		texture, breaking batches wherever the group, texture, or primitive type changes. This is kept when
+		the layer empties out. Opaque geometry in the layer is sorted too, instead of going in the opaque pass.
+		\sa getLayerSort(), setDepthLayers()
+	*/
+	void setLayerSort( float _depth, E_LAYER_SORT _sort );
+
+	//! Gets how the layer with _depth in it is ordered.
+	E_LAYER_SORT getLayerSort( float _depth );
+
+	//! Draws depths in steps of _step together.
+	/*!
+		Depths are rounded down to a multiple of _step, and everything that rounds to the same layer is drawn
+		as if it had the same depth, so it can be batched together. This is for geometry that's given slightly
+		different depths just to keep it off of its neighbors. Passing 0 draws every depth separately again (the default).
+		\sa setDepthLayers(), getMergedDepthCount()
+	*/
+	void setDepthQuantization( float _step );
+
+	//! Draws depths in a fixed number of layers.
+	/*!
+		Like setDepthQuantization(), but [_min, _max) is split into _layers layers, and depths outside of it
+		go in the first or last layer, so there are never more than _layers depths to draw.
+	*/
+	void setDepthLayers( unsigned int _layers, float _min, float _max );
+
+	//! Checks if depths are being put into layers.
+	inline bool getDepthLayering() const { return layer_step > 0; }
+
+	//! Gets the depth that geometry at _depth is drawn at.
+	inline float getLayerDepth( float _depth ) const
+	{
+		if( layer_step <= 0 ) return _depth;
+		float layer = std::floor( ( _depth - layer_min ) / layer_step );
+		if( layer_count )
+		{
+			if( layer < 0 ) layer = 0;
+			if( layer > layer_count - 1 ) layer = (float)( layer_count - 1 );
+		}
+		return layer_min + layer * layer_step;
+	}
+
+	//! Gets the number of depths being drawn.
+	unsigned int getDepthLayerCount();
+
+	//! Gets the number of different depths the geometry has, which can be more than are drawn when depths are layered.
+	unsigned int getDistinctDepthCount();
+
+	//! Gets the number of depths that were drawn together with another depth because of layering.
+	inline unsigned int getMergedDepthCount()
+	{
+		unsigned int distinct = getDistinctDepthCount(), layers = getDepthLayerCount();
+		return distinct > layers ? distinct - layers : 0;
+	}
+
+    //! Cleaning routine
+	void clean();
+
+	//! Sets the group state for a given group id.
+	inline void addGroupState( const signed int _id, GroupStatePtr _gs ){
+		groupstates[_id] = _gs; 
+	}
+
+	//! Removes the group state for the given group id.
+	inline void removeGroupState( const signed int _id ){
+		groupstates.erase( _id );
+	}
+
+	//! Gets the group state for the given group id.
+	inline GroupStatePtr getGroupState( const signed int _id ){
+		return groupstates[_id];
+	}
+
+	//! Gets the number of times the group state changed in the last draw().
+	inline unsigned int getGroupSwitches() const { return group_switches; }
+
+	//! Gets how many of the group state changes in the last draw() skipped end() and begin() (see GroupState::isEquivalent()).
+	inline unsigned int getElidedGroupSwitches() const { return elided_group_switches; }
+
+    //! Sets the renderer's view.
+    inline void setView( const View& other ) { view = other; }
+
+    //! Gets a reference to the renderer's view.
+    inline View& getView() { return view; }
+
+	//! Sets the renderer's target, if an empty pointer, the target is the window's framebuffer
+	/*!
+		The opaque pass isn't used while a target is set, see setOpaquePass().
+	*/
+    void setRenderTarget( RenderTargetPtr _t = RenderTargetPtr() );
+
+    //! Gets a reference to the renderer's view.
+    inline RenderTargetPtr getRenderTarget() {return target; }
+
+	//! Sets the renderer's shader. If an empty pointer, the renderer will use the FFP
+	inline void setShader( ShaderPtr _s ) { shader = _s; }
+
+	//! Get the renderer's shader.
+	inline ShaderPtr getShader(){ return shader; }
+
+	//! Draws everything in the graph.
+	/*
+		\param pesist_immediate If set to true, immediate geometry will persist until the next time draw() is called, this is useful for RTT.
+	*/
+	void draw( bool _persist_immediate = false );
+
+	//! Draws a single geometry immediately
+	/*!
+		Automatically activates any attached rendertarget, and deactivates it before returning.
+	*/
+	void drawImmediately(  boost::intrusive_ptr<BatchGeometry> geom );
+
+	//! Clears the screen to the given color. Does not activate the current render target.
+    inline static void clearScreen( const Color& _c = Color(0,0,0) )
+    {
+        glClearColor( _c.getRed()/255.0f,_c.getGreen()/255.0f,_c.getBlue()/255.0f,_c.getAlpha()/255.0f );
+        glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
+    }
+
+	//! Get the default clear color
+    inline const Color& getClearColor() { return clear_color; }
+
+    //! Set the default clear color
+    inline void setClearColor(const Color& c) { clear_color = c; }
+
+	//! Enable/disable clearing (disabled by default, except for the rendersystem's batcher).
+	inline void setClearing( bool c ){ enable_clear = c; }
+
+#ifdef DEBUG_BATCHRENDERER
+	//! Lists all the geometry in the list.
+	void listGeometry();
+#endif
+
+private:
+
+	typedef std::list< boost::intrusive_ptr<BatchGeometry> > GEOMCONTAINER;
+
+	//! Geometry with the same depth, group, texture, and primitive type.
+	struct Bucket
+	{
+		//! Persistent geometry.
+		GEOMCONTAINER geoms;
+
+		//! Arena geometry, emptied after each draw.
+		std::vector< BatchGeometry* > transient;
+
+		Bucket() : geoms(), transient() {}
+
+		inline bool empty() const { return geoms.empty() && transient.empty(); }
+	};
+
+	typedef boost::unordered_map< unsigned int, Bucket > BATCHMAPALPHA; // Primitive Keyed
+	typedef boost::unordered_map< unsigned int, BATCHMAPALPHA > BATCHMAPBETA; // Texture Keyed
+	typedef boost::unordered_map< signed int, BATCHMAPBETA > BATCHMAPGAMMA; // Group Keyed
+	typedef std::map< float, BATCHMAPGAMMA > BATCHMAPDELTA; // Depth Keyed (Ordered)
+
+	//! Geometry List Container.
+	BATCHMAPDELTA geometry;
+
+	//! Recycle list
+	std::vector< boost::intrusive_ptr<BatchGeometry> > recyclelist;
+
+	//! Arena of immediate geometry, the first arena_used are in use this frame.
+	std::vector< boost::intrusive_ptr<BatchGeometry> > arena;
+	unsigned int arena_used;
+
+	//! Vertices waiting to be submitted.
+	/*!
+		The storage is kept between draws and only grows, and the first size vertices are in use. Geometry
+		is batched straight into it with BatchGeometry::batchInto(), so nothing is constructed and then
+		copied over, and a steady scene batches without allocating.
+	*/
+	struct VertexBatch
+	{
+		std::vector< Vertex > storage;
+		unsigned int size;
+
+		VertexBatch() : storage(), size(0) {}
+
+		//! Makes room for _n more vertices and returns where they go.
+		inline Vertex* extend( unsigned int _n )
+		{
+			if( size + _n > storage.size() ) storage.resize( std::max( size + _n, (unsigned int) storage.size() * 2 ) );
+			return storage.empty() ? NULL : &storage[0] + size;
+		}
+
+		inline bool empty() const { return size == 0; }
+	};
+
+	//! Vertex list draw() batches into.
+	VertexBatch vlist;
+
+	//! Vertex list clipped geometry is batched into, it's submitted on its own.
+	VertexBatch clip_vlist;
+
+	//! A piece of geometry in a Y sorted layer, with its key from the last time it was sorted.
+	struct SortEntry
+	{
+		float key;
+		BatchGeometry* geom;
+
+		inline bool operator< ( const SortEntry& other ) const { return key < other.key; }
+	};
+
+	//! The order of a Y sorted layer.
+	struct SortedLayer
+	{
+		//! The geometry in the order it was last drawn, not counting arena geometry.
+		std::vector< SortEntry > entries;
+
+		//! This frame's arena geometry, sorted on its own and drawn merged with entries (kept for its storage).
+		std::vector< SortEntry > transients;
+
+		//! If geometry (other than arena geometry) was added to or removed from the layer since then.
+		bool changed;
+
+		SortedLayer() : entries(), transients(), changed(true) {}
+	};
+
+	//! Y sorted layers, keyed by layer depth.
+	typedef boost::unordered_map< float, SortedLayer > SORTEDLAYERMAP;
+	SORTEDLAYERMAP sorted_layers;
+
+	//! Opaque geometry for the opaque pass, keyed by group, texture, and then primitive type.
+	BATCHMAPGAMMA opaque_geometry;
+	bool opaque_pass;
+
+	//! Depth layering, off when layer_step is 0. layer_count is 0 for plain quantization.
+	float layer_step;
+	float layer_min;
+	unsigned int layer_count;
+
+	//! How much geometry there is at each depth, only kept while layering.
+	boost::unordered_map< float, unsigned int > depth_counts;
+
+	typedef boost::unordered_map< signed int, boost::shared_ptr<GroupState> > GROUPSTATEMAP;
+	//! Map of group states.
+	GROUPSTATEMAP groupstates;
+
+	//! The group state that's been begun and not ended yet while drawing, and the group it was for.
+	GroupStatePtr active_state;
+	signed int active_group;
+
+	//! Group state changes in the last draw(), and how many of them were skipped.
+	unsigned int group_switches;
+	unsigned int elided_group_switches;
+
+    //! View
+    View view;
+
+	//! Current shader
+	ShaderPtr shader;
+
+	//! Current render target
+	RenderTargetPtr target;
+
+	//! GL clear color
+    Color clear_color;
+	bool enable_clear;
+
+	//! Immediate persistence
+	bool persist_immediate;
+
+	//! Real removal routine ( used by clean() and move() ).
+	void removeProper( boost::intrusive_ptr<BatchGeometry> _g , bool _inv = false);
+
+	//! Resets the arena after drawing, keeping geometry that was made persistent.
+	void resetArena();
+
+	//! Files all the geometry again after the depth layers, layer sorting, or opaque pass change.
+	void relayer();
+
+	//! Files the geometry from an old graph of groups into the current graphs.
+	void refile( BATCHMAPGAMMA& _groups );
+
+	//! Checks if geometry with this depth and opacity goes in the opaque graph.
+	inline bool filesOpaque( float _depth, bool _opaque ) const
+	{
+		return _opaque && usingOpaquePass() && sorted_layers.find( getLayerDepth( _depth ) ) == sorted_layers.end();
+	}
+
+	//! Gets the bucket geometry with this key goes in, marking its layer as changed if it's Y sorted.
+	/*!
+		Arena geometry isn't kept in a Y sorted layer's order (it's sorted on its own each frame), so it doesn't change the layer.
+	*/
+	inline Bucket& bucketFor( float _depth, signed int _group, unsigned int _texture, unsigned int _primitive, bool _opaque, bool _transient = false )
+	{
+		if( filesOpaque( _depth, _opaque ) ) return opaque_geometry[ _group ][ _texture ][ _primitive ];
+		const float layer = getLayerDepth( _depth );
+		if( ! _transient ) touchLayer( layer );
+		return geometry[ layer ][ _group ][ _texture ][ _primitive ];
+	}
+
+	//! Draws (and prunes) a graph of groups, for one depth or for the opaque pass.
+	void drawGroups( BATCHMAPGAMMA& _groups, bool& _clipping, phoenix::Rectangle& _clipping_rect );
+
+	//! Draws (and prunes) the textures in one group.
+	void drawGroup( signed int _group, BATCHMAPBETA& _textures, bool& _clipping, phoenix::Rectangle& _clipping_rect );
+
+	//! Switches to a group's state, skipping the switch if the states are equivalent.
+	void enterGroup( signed int _group );
+
+	//! Ends the active group state.
+	void leaveGroup();
+
+	//! Draws (and prunes) a Y sorted layer.
+	void drawSorted( SortedLayer& _layer, BATCHMAPGAMMA& _groups, bool& _clipping, phoenix::Rectangle& _clipping_rect );
+
+	//! Empties the transient lists of a graph of groups after drawing, and prunes what's empty.
+	void pruneGroups( BATCHMAPGAMMA& _groups );
+
+	//! Marks the Y sorted layer (if any) at a layer depth as changed.
+	inline void touchLayer( float _layer )
+	{
+		if( sorted_layers.empty() ) return;
+		SORTEDLAYERMAP::iterator it = sorted_layers.find( _layer );
+		if( it != sorted_layers.end() ) it->second.changed = true;
+	}
+
+	//! Takes one away from the count of geometry at _depth.
+	void forgetDepth( float _depth );
+
+	//! Batches one piece of geometry.
+	void batchGeometry( BatchGeometry* _geom, unsigned int _texture, unsigned int _primitive, bool& _texture_set, VertexBatch& _vlist, bool& _clipping, phoenix::Rectangle& _clipping_rect );
+
+	//! Batches a piece of geometry onto the end of a vertex list, returns the number of vertices written.
+	unsigned int batchInto( BatchGeometry* _geom, VertexBatch& _vlist, bool _persist );
+
+	//! Clipping Routine
+	bool clipGeometry(  boost::intrusive_ptr<BatchGeometry> geom, bool &clipping, phoenix::Rectangle &clipping_rect );
+
+	//! Vertex submission routine.
+	void submitVertexList( VertexBatch& vlist, unsigned int type );
+};
+
+} //namespace phoenix
+
+#include "BatchGeometry.h"
+
+#endif //__PH_BATCH_RENDERER_H__
@@ -1,144 +1,307 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-#ifndef __PHBITMAPFONT_H__
-#define __PHBITMAPFONT_H__
-
-#include <vector>
-#include <boost/unordered_map.hpp>
-#include "config.h"
-#include "Font.h"
-#include "BatchRenderer.h"
-#include "BatchGeometry.h"
-#include "BatchGeometryComposite.h"
-
-namespace phoenix
-{
-
-//! Bitmap Font
-/*!
-    This class provides a simple interface to draw fonts based on textures containing a glyph for all 256
-    characters. A built-in texture is supplied for the default font used by RenderSystem.
-*/
-class BitmapFont
-    : public Font
-{
-public:
-
-	//! Structure to hold information about each character
-	struct Character{
-		int x;
-		int y;
-		int width;
-		int height;
-		int xoffset;
-		int yoffset;
-		int xadvance;
-		unsigned int page;
-	};
-
-	//! Constructor
-	/*!
-		Makes a new Bitmap font and loads everything from a FNT file.
-	*/
-	BitmapFont( RenderSystem& _r, std::string _fnt = "");
-
-    //! Advanced Constructor
-    /*!
-        Makes a new (empty) Bitmap Font.
-		You must manually load in pages, etc.
-        \param _rm A resource manager to keep track of this object.
-        \param _br A batch renderer for this font to draw to.
-        \note Sets the resource type to ERT_BITMAP_FONT
-    */
-    BitmapFont( ResourceManager& _r, BatchRenderer& _b )
-        : Font( _r, _b, 3), pages(), characters(256), kernings(), line_height(16.0f), spacing( 10.0f )
-    {
-        setName("Unnamed font");
-		std::fill( characters.begin(), characters.end(), BitmapFont::Character() );
-    }
-
-    virtual ~BitmapFont()
-    {}
-
-	//! Loads a BMFont text format .fnt file.
-	/*
-		Requires a rendersystem to load textures
-	*/
-	virtual void load( RenderSystem& _r, std::string _fnt = "" );
-
-	//! Gets the rendered dimensions of a piece of text.
-	virtual const Vector2d getTextDimensions( const std::string& _s, const Vector2d& _scale = Vector2d(0,0) );
-
-	//! Draws the given string at the given location.
-	virtual BatchGeometryPtr drawText( const std::string& s, const Vector2d& p = Vector2d(0,0), const Color& _c = Color(255,255,255), const Vector2d& _scale = Vector2d(0,0), E_TEXT_ALIGNMENT _align = T_ALIGN_LEFT );
-
-    //! Gets the spacing between words.
-    inline float getSpacing() const { return spacing; }
-
-    //! Set spacing, default is 10.0f.
-	inline void setSpacing( float s = 10.0f) { spacing = s; }
-
-	//! Sets the character properties (Loader Interface).
-	inline void setCharacterProperties( int _ix, const BitmapFont::Character& _c ){ characters[_ix] = _c; }
-
-	//! Sets a kerning pair (Loader Interface).
-	inline void setKerning( int _f, int _s, int _v ) { kernings[ KerningKey(_f,_s) ] = _v; }
-
-	//! Fetches the kerning value for a pair
-	inline int getKerning( int _f, int _s ) { return kernings[ KerningKey(_f,_s) ]; }
-
-	//! Gets the line height.
-    inline float getLineHeight() const { return line_height; }
-
-    //! Set the line height. (loader interface)
-	inline void setLineHeight( float l ) { line_height = l; }
-
-	//! Sets a texture for a specific page
-	inline void setPage( unsigned int _ix, TexturePtr _t ){
-		if( pages.size() < _ix+1 ) pages.resize( _ix + 1 );
-		pages[_ix] = _t;
-		if( _ix == 0 ) setTexture(_t);
-	}
-
-	//! Get a texture for a specific page
-	inline TexturePtr getPage( unsigned int _ix ){
-		if( _ix >= pages.size() ) return TexturePtr();
-		return pages[_ix];
-	}
-
-protected:
-
-	//! Textures for pages
-	std::vector< TexturePtr > pages; 
-
-	//! Character List
-	std::vector< BitmapFont::Character > characters; 
-
-	//! Kerning pairs
-	typedef std::pair<int,int> KerningKey;
-	typedef boost::unordered_map< KerningKey, int > KerningMap;
-	KerningMap kernings;
-
-	//! Line height
-	float line_height;
-
-    //! Spacing between characters when drawn.
-    float spacing;
-
-	//! Temporary storage of line widths used when drawing text (speeds things up).
-	std::vector<float> line_widths;
-
-};
-
-//! Friendly BitmapFont pointer
-typedef boost::intrusive_ptr<BitmapFont> BitmapFontPtr;
-
-} //namespace phoenix
-#endif // __PHBITMAPFONT_H__
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHBITMAPFONT_H__
+#define __PHBITMAPFONT_H__
+
+#include <vector>
+#include <algorithm>
+#include "config.h"
+#include "Functions.h"
+#include "Font.h"
+#include "BatchRenderer.h"
+#include "BatchGeometry.h"
+#include "BatchGeometryComposite.h"
+
+namespace phoenix
+{
+
+class TextGeometry;
+
+//! Bitmap Font
+/*!
+    This class provides a simple interface to draw fonts based on textures containing glyphs.
+	Text is UTF-8, and any unicode character can have a glyph. Glyphs are kept in a two level table,
+	the first 256 characters are always there and further characters are stored in blocks of 256 that are
+	only allocated when a character in them is set, so every lookup is two array indexes.
+	A built-in texture is supplied for the default font used by RenderSystem.
+*/
+class BitmapFont
+    : public Font
+{
+public:
+
+	//! Structure to hold information about each character
+	struct Character{
+		int x;
+		int y;
+		int width;
+		int height;
+		int xoffset;
+		int yoffset;
+		int xadvance;
+		unsigned int page;
+	};
+
+	//! Where layoutText() put a glyph
+	struct Placement
+	{
+		float pen_x; //!< Pen position before the glyph (relative to the text)
+		float pen_y;
+		unsigned int line; //!< Line the glyph is on
+		unsigned int page; //!< Page of the glyph, NO_PAGE for line breaks and glyphs on pages the font doesn't have
+		unsigned int vertex; //!< Index of the glyph's first vertex in the page geometry, set by writeText()
+	};
+
+	//! Page of glyphs that aren't drawn.
+	static const unsigned int NO_PAGE = (unsigned int)-1;
+
+	//! Kerning pair
+	struct KerningPair{
+		int first;
+		int second;
+		int amount;
+
+		//! Orders by first then second character.
+		inline bool operator<( const KerningPair& _o ) const { return first < _o.first || ( first == _o.first && second < _o.second ); }
+	};
+
+	//! Constructor
+	/*!
+		Makes a new Bitmap font and loads everything from a FNT file.
+	*/
+	BitmapFont( RenderSystem& _r, std::string _fnt = "");
+
+    //! Advanced Constructor
+    /*!
+        Makes a new (empty) Bitmap Font.
+		You must manually load in pages, etc.
+        \param _rm A resource manager to keep track of this object.
+        \param _br A batch renderer for this font to draw to.
+        \note Sets the resource type to ERT_BITMAP_FONT
+    */
+    BitmapFont( ResourceManager& _r, BatchRenderer& _b )
+        : Font( _r, _b, 3), pages(), characters(256), blocks(), kernings(), kerning_sorted(true), line_height(16.0f), spacing( 10.0f ), distance_field(false), line_widths(), text_codepoints(), text_placements()
+    {
+        setName("Unnamed font");
+		std::fill( characters.begin(), characters.end(), BitmapFont::Character() );
+    }
+
+    virtual ~BitmapFont()
+    {}
+
+	//! Loads a BMFont text format .fnt file.
+	/*
+		Requires a rendersystem to load textures
+	*/
+	virtual void load( RenderSystem& _r, std::string _fnt = "" );
+
+	//! Gets the rendered dimensions of a piece of text.
+	virtual const Vector2d getTextDimensions( const std::string& _s, const Vector2d& _scale = Vector2d(0,0) );
+
+	//! Draws the given string at the given location.
+	/*!
+		The geometry is immediate, use createText() for text that stays on screen. Text in a font with one page
+		is written into the renderer's immediate arena (see BatchRenderer::createImmediate()).
+	*/
+	virtual BatchGeometryPtr drawText( const std::string& s, const Vector2d& p = Vector2d(0,0), const Color& _c = Color(255,255,255), const Vector2d& _scale = Vector2d(0,0), E_TEXT_ALIGNMENT _align = T_ALIGN_LEFT );
+
+	//! Decodes UTF-8 text into code points.
+	static void decodeText( const std::string& _s, std::vector< unsigned int >& _out );
+
+	//! Lays out decoded text.
+	/*!
+		Finds the pen position of every glyph and the width of every line. This is the layout both drawText()
+		and TextGeometry use, the quads are then written with writeText().
+		eturn The dimensions of the text.
+	*/
+	Vector2d layoutText( const std::vector< unsigned int >& _cp, const Vector2d& _scale, std::vector< Placement >& _placements, std::vector< float >& _line_widths ) const;
+
+	//! Appends the quads of text laid out by layoutText() to one geometry for each page, and sets where each glyph's vertices are.
+	/*!
+		\param _width The width of the text, which the lines are aligned in.
+		\param _pages The geometry for each page, glyphs on pages past _page_count aren't written.
+	*/
+	void writeText( const std::vector< unsigned int >& _cp, std::vector< Placement >& _placements, const std::vector< float >& _line_widths, float _width,
+		const Vector2d& _p, const Color& _c, const Vector2d& _scale, E_TEXT_ALIGNMENT _align, const BatchGeometryPtr* _pages, unsigned int _page_count ) const;
+
+	//! Gets the four vertices of a placed glyph.
+	void glyphQuad( unsigned int _cp, const Placement& _pl, const Vector2d& _p, float _x_offset, const Color& _c, const Vector2d& _scale, Vertex* _out ) const;
+
+	//! Gets the pen advance after the code point at _i, with its kerning against the next one.
+	inline float getAdvance( const std::vector< unsigned int >& _cp, unsigned int _i, const Vector2d& _scale ) const
+	{
+		float x = (float) getCharacter( _cp[_i] ).xadvance;
+		if( _i+1 < _cp.size() ){
+			x += (float) getKerning( _cp[_i], _cp[_i+1] );
+		}
+		return x * _scale.getX();
+	}
+
+	//! Gets the horizontal offset of a line for the alignment.
+	static inline float getAlignmentOffset( E_TEXT_ALIGNMENT _align, float _width, float _line_width )
+	{
+		if( _align == T_ALIGN_CENTER ) return (_width/2.0f) - (_line_width/2.0f);
+		if( _align == T_ALIGN_RIGHT ) return _width - _line_width;
+		return 0.0f;
+	}
+
+	//! Creates retained text.
+	/*!
+		The text is laid out once and kept until it is changed, see TextGeometry.
+	*/
+	boost::intrusive_ptr<TextGeometry> createText( const std::string& _s, const Vector2d& _p = Vector2d(0,0), const Color& _c = Color(255,255,255), const Vector2d& _scale = Vector2d(0,0), E_TEXT_ALIGNMENT _align = T_ALIGN_LEFT );
+
+    //! Gets the spacing between words.
+    inline float getSpacing() const { return spacing; }
+
+    //! Set spacing, default is 10.0f.
+	inline void setSpacing( float s = 10.0f) { spacing = s; }
+
+	//! Sets the character properties (Loader Interface).
+	/*!
+		\param _ix The unicode code point of the character.
+	*/
+	void setCharacterProperties( int _ix, const BitmapFont::Character& _c );
+
+	//! Gets the properties of a character, the first character if it doesn't have a glyph.
+	/*!
+		\param _ix The unicode code point of the character.
+	*/
+	inline const BitmapFont::Character& getCharacter( unsigned int _ix ) const {
+		if( _ix < 256 ) return characters[_ix];
+		const unsigned int block = _ix >> 8;
+		if( block >= blocks.size() || blocks[block] == 0 ) return characters[0];
+		return characters[ blocks[block] + (_ix & 0xff) ];
+	}
+
+	//! Gets the number of 256 character blocks allocated beyond the first.
+	inline unsigned int getBlockCount() const { return ( characters.size() / 256 ) - 1; }
+
+	//! Sets a kerning pair (Loader Interface).
+	/*!
+		Pairs are collected as they are set, buildKerning() must be called once they are all in.
+	*/
+	inline void setKerning( int _f, int _s, int _v ) {
+		KerningPair k = { _f, _s, _v };
+		kernings.push_back( k );
+		kerning_sorted = false;
+	}
+
+	//! Sorts the kerning pairs into a table for fast lookups (Loader Interface).
+	/*!
+		If a pair was set more than once, the last value set is kept.
+	*/
+	void buildKerning();
+
+	//! Fetches the kerning value for a pair, 0 if there isn't one.
+	/*!
+		This is a binary search of the kerning table, and never modifies it.
+	*/
+	inline int getKerning( int _f, int _s ) const {
+		if( kernings.empty() ) return 0;
+
+		KerningPair k = { _f, _s, 0 };
+		std::vector< KerningPair >::const_iterator it;
+		if( kerning_sorted ){
+			it = std::lower_bound( kernings.begin(), kernings.end(), k );
+		} else {
+			// Not built yet, the last one set wins.
+			std::vector< KerningPair >::const_reverse_iterator r = kernings.rbegin();
+			while( r != kernings.rend() && ( r->first != _f || r->second != _s ) ) ++r;
+			return r != kernings.rend() ? r->amount : 0;
+		}
+
+		return ( it != kernings.end() && it->first == _f && it->second == _s ) ? it->amount : 0;
+	}
+
+	//! Gets the number of kerning pairs.
+	inline unsigned int getKerningCount() const { return kernings.size(); }
+
+	//! Gets the line height.
+    inline float getLineHeight() const { return line_height; }
+
+    //! Set the line height. (loader interface)
+	inline void setLineHeight( float l ) { line_height = l; }
+
+	//! Sets a texture for a specific page
+	inline void setPage( unsigned int _ix, TexturePtr _t ){
+		if( pages.size() < _ix+1 ) pages.resize( _ix + 1 );
+		pages[_ix] = _t;
+		if( _ix == 0 ) setTexture(_t);
+	}
+
+	//! Get a texture for a specific page
+	inline TexturePtr getPage( unsigned int _ix ){
+		if( _ix >= pages.size() ) return TexturePtr();
+		return pages[_ix];
+	}
+
+	//! Gets the number of pages.
+	inline unsigned int getPageCount() const { return pages.size(); }
+
+	//! Converts the font to a signed distance field font.
+	/*!
+		Every page is replaced by its distance field (see DistanceFieldGenerator), and the font's geometry is put
+		in the given group, which is given a ShaderGroupState with the distance field shader unless it already has
+		a state (so fonts can share a group). Text of any size can then be drawn crisply from the same pages, so
+		every size batches together. The bitmap pages are let go of rather than dropped, since other fonts can share them.
+		\param _group The group for the font's text, which shouldn't be used for anything else.
+		\param _spread The spread of the distance field in pixels, see DistanceFieldGenerator.
+		\param _threads Number of threads to generate with, 0 uses every core.
+		\return False if shaders aren't available, the text is still drawn but without the crisp edges.
+	*/
+	bool makeDistanceField( signed int _group, float _spread = 8.0f, unsigned int _threads = 0 );
+
+	//! Checks if this is a distance field font.
+	inline bool isDistanceField() const { return distance_field; }
+
+protected:
+
+	//! Textures for pages
+	std::vector< TexturePtr > pages; 
+
+	//! Character List, the first 256 characters and then each allocated block
+	std::vector< BitmapFont::Character > characters; 
+
+	//! Offset of each block of 256 characters in the character list, 0 if it isn't allocated
+	std::vector< unsigned int > blocks;
+
+	//! Kerning pairs, sorted by buildKerning()
+	std::vector< KerningPair > kernings;
+
+	//! Kerning table is sorted
+	bool kerning_sorted;
+
+	//! Line height
+	float line_height;
+
+    //! Spacing between characters when drawn.
+    float spacing;
+
+	//! Distance field font
+	bool distance_field;
+
+	//! Temporary storage of line widths used when drawing text (speeds things up).
+	std::vector<float> line_widths;
+
+	//! Temporary storage of the code points and glyph placements of text drawn with drawText().
+	std::vector< unsigned int > text_codepoints;
+	std::vector< Placement > text_placements;
+
+};
+
+//! Friendly BitmapFont pointer
+typedef boost::intrusive_ptr<BitmapFont> BitmapFontPtr;
+
+} //namespace phoenix
+
+#include "TextGeometry.h"
+
+#endif // __PHBITMAPFONT_H__
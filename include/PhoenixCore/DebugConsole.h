@@ -2,6 +2,7 @@
 #define __PH_DEBUG_CONSOLE_H__
 
 #include <string>
+#include <vector>
 #include "config.h"
 #include "2dGraphicsFactory.h"
 #include "WindowManager.h"
@@ -19,6 +20,10 @@ class Font;
     The debug console provides an easy and familiar way to debug graphical applications in phoenix. Any
 	class that can be written to an ostream can be used in the write() function. There is usually only
 	one DebugConsole and it is accessible through RenderSystem::getDebugConsole();
+
+	Lines are kept in a fixed size ring buffer, and each line that's on screen keeps its own geometry. Only
+	lines that are new or changed are laid out, lines that scroll are just moved, and nothing is done at
+	all while the console is closed or hasn't changed.
 */
 class DebugConsole
     : public virtual GraphicsFactory2d
@@ -34,6 +39,9 @@ public:
     //! Destructor
     virtual ~DebugConsole() {
 		event_connection.disconnect();
+		clear();
+		release( background );
+		release( header );
 	}
 
 	//! Listens for Window Events ( To Open/Close the console ).
@@ -43,16 +51,16 @@ public:
     boost::intrusive_ptr<Font> getFont() { return font; }
 
     //! Set the font.
-    void setFont( boost::intrusive_ptr<Font> _f ) { font = _f; }
+    void setFont( boost::intrusive_ptr<Font> _f ) { font = _f; invalidate(); }
 
     //! Set the background color.
-    void setBackgroundColor( const Color& _c = Color(0,0,0,200) ) { backcolor = _c; }
+    void setBackgroundColor( const Color& _c = Color(0,0,0,200) ) { backcolor = _c; invalidate(); }
 
     //! Get the background color.
     const Color& getBackgroundColor() { return backcolor; }
 
     //! Set the color used to draw text.
-    void setFontColor( const Color& _c = Color(127,127,255) ) { fontcolor = _c; }
+    void setFontColor( const Color& _c = Color(127,127,255) ) { fontcolor = _c; invalidate(); }
 
     //! Get the text color.
     const Color& getFontColor() { return fontcolor; }
@@ -79,18 +87,39 @@ public:
     //! Clear the debug console.
     void clear()
     {
-        lines.clear();
+        for( unsigned int i = 0; i < count; ++i )
+        {
+            line(i).text.clear();
+            release( line(i).geom );
+        }
+        head = count = 0;
+        changed = true;
     }
 
     //! Prints the console's content to cout.
     void dump()
     {
-        for( std::deque< std::string >::iterator i = lines.begin(); i != lines.end(); ++i )
+        for( unsigned int i = 0; i < count; ++i )
         {
-            std::cout<<(*i)<<std::endl;
+            std::cout<<line(i).text<<std::endl;
         }
     }
 
+    //! Gets the number of lines kept.
+    inline unsigned int getLineCount() const { return count; }
+
+    //! Gets a line, 0 is the oldest.
+    inline const std::string& getLine( unsigned int _i ) const { return ring[ (head + _i) % ring.size() ].text; }
+
+    //! Set the number of lines kept, the oldest lines are discarded if there are more.
+    void setCapacity( unsigned int _c = 256 );
+
+    //! Gets the number of lines kept.
+    inline unsigned int getCapacity() const { return ring.size(); }
+
+    //! Gets the number of lines that have been laid out, for profiling.
+    inline unsigned int getLayoutCount() const { return layout_count; }
+
     //! Update the line limit based on the size of the window.
     void updateLineLimit()
     {
@@ -104,9 +133,7 @@ public:
     //! Removes old lines that are beyond the limit of displayable lines.
     void limitLines()
     {
-        unsigned int size = lines.size();
-        if( size > linelimit )
-            lines.erase( lines.begin(), lines.begin()+( size-linelimit ) );
+        while( count > linelimit ) evict();
     }
 
     //! Stream operator.
@@ -122,8 +149,8 @@ public:
 
     //! Draw the console.
     /*!
-        Runs through all the lines and draws them. Automatically called on the
-		WET_UPDATE event.
+        Lays out the lines that changed and moves the ones that scrolled. Called
+		every frame by RenderSystem::run().
     */
     void draw( );
     
@@ -135,6 +162,40 @@ public:
 
 protected:
 
+	//! A line in the console.
+	struct Line
+	{
+		//! Text.
+		std::string text;
+
+		//! Geometry, if the line is on screen.
+		BatchGeometryPtr geom;
+
+		//! Row the geometry was laid out at.
+		unsigned int row;
+	};
+
+	//! Gets a line, 0 is the oldest.
+	inline Line& line( unsigned int _i ) { return ring[ (head + _i) % ring.size() ]; }
+
+	//! Adds a new line at the end, evicting the oldest if the ring is full.
+	Line& push();
+
+	//! Removes the oldest line.
+	void evict();
+
+	//! Drops geometry.
+	inline void release( BatchGeometryPtr& _g ) {
+		if( _g ) _g->drop();
+		_g = BatchGeometryPtr();
+	}
+
+	//! Shows or hides all of the console's geometry.
+	void show( bool _s );
+
+	//! Throws away all geometry so it's made again on the next draw.
+	void invalidate();
+
 	//! Connection to Window Manager
 	boost::signals2::connection event_connection;
 
@@ -144,8 +205,27 @@ protected:
 	//! Enabled or not.
     bool enabled;
 
-	//! List of lines.
-    std::deque< std::string > lines;
+	//! Ring buffer of lines.
+    std::vector< Line > ring;
+
+	//! Index of the oldest line.
+	unsigned int head;
+
+	//! Number of lines.
+	unsigned int count;
+
+	//! Background and title geometry.
+	BatchGeometryPtr background;
+	BatchGeometryPtr header;
+
+	//! The console's geometry is enabled.
+	bool shown;
+
+	//! Something changed since the last draw.
+	bool changed;
+
+	//! Lines laid out.
+	unsigned int layout_count;
 
 	//! The most lines that can be displayed on the screen.
     unsigned int linelimit;
@@ -0,0 +1,105 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHDISTANCEFIELD_H__
+#define __PHDISTANCEFIELD_H__
+
+#include <vector>
+#include "config.h"
+#include "Texture.h"
+#include "Shader.h"
+
+namespace phoenix
+{
+
+//! Signed Distance Field Generator
+/*!
+	Turns the alpha channel of an image (such as a BitmapFont page) into a signed distance field, where
+	the alpha of each pixel is its distance to the nearest edge. 128 is right on the edge, more is inside
+	and less is outside. Unlike plain alpha, a distance field can be scaled up and still be cut into a
+	crisp edge by the shader from createShader(), so one atlas can be drawn at any size.
+
+	The distances are exact euclidean distances, computed with a separable transform: every column is
+	done, then every row, and the columns and rows are divided between threads.
+	\note Glyphs should have at least the spread of padding between them in the atlas, or their fields will touch.
+	\sa BitmapFont::makeDistanceField()
+*/
+class DistanceFieldGenerator
+{
+
+public:
+
+	//! Constructor
+	/*!
+		\param _spread The distance in pixels that maps to the full range of alpha, on either side of the edge.
+		\param _threads Number of threads to use, 0 uses every core.
+	*/
+	DistanceFieldGenerator( float _spread = 8.0f, unsigned int _threads = 0 )
+		: spread( _spread ), threads( _threads )
+	{
+	}
+
+	//! Set spread.
+	inline void setSpread( float _s ) { spread = _s; }
+
+	//! Get spread.
+	inline float getSpread() const { return spread; }
+
+	//! Set the number of threads, 0 uses every core.
+	inline void setThreads( unsigned int _t ) { threads = _t; }
+
+	//! Get the number of threads.
+	inline unsigned int getThreads() const { return threads; }
+
+	//! Generates a distance field from RGBA data.
+	/*!
+		\param _src The source image, pixels with alpha of 128 or more are inside.
+		\param _w Width.
+		\param _h Height.
+		\param _dst The destination image (can't be the source), it is white with the distance in alpha.
+	*/
+	void generate( const GLubyte* _src, unsigned int _w, unsigned int _h, GLubyte* _dst ) const;
+
+	//! Generates a distance field texture from a texture.
+	/*!
+		Reads the texture back from video memory, the new texture is made with linear filtering.
+		\return The new texture, or an empty pointer if the texture couldn't be read.
+	*/
+	TexturePtr generate( TexturePtr _t ) const;
+
+	//! Creates the shader for drawing distance fields.
+	/*!
+		The shader cuts the field at its edge, smoothing over about a screen pixel whatever the scale. Geometry
+		color is used as the color of the text.
+	*/
+	static ShaderPtr createShader( ResourceManager& _r );
+
+protected:
+
+	//! Squared distance transform of every column in a range.
+	void columns( std::vector<float>* _grid, unsigned int _w, unsigned int _h, unsigned int _begin, unsigned int _end ) const;
+
+	//! Squared distance transform of every row in a range.
+	void rows( std::vector<float>* _grid, unsigned int _w, unsigned int _h, unsigned int _begin, unsigned int _end ) const;
+
+	//! Runs a pass split between the threads.
+	void parallel( void (DistanceFieldGenerator::*_pass)( std::vector<float>*, unsigned int, unsigned int, unsigned int, unsigned int ) const,
+		std::vector<float>* _grid, unsigned int _w, unsigned int _h, unsigned int _count ) const;
+
+	//! Spread
+	float spread;
+
+	//! Threads
+	unsigned int threads;
+
+};
+
+} //namespace phoenix
+
+#endif //__PHDISTANCEFIELD_H__
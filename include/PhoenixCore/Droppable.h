@@ -1,105 +1,153 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-#ifndef __PHDROPPABLE_H__
-#define __PHDROPPABLE_H__
-
-#include <boost/intrusive_ptr.hpp>
-#include "config.h"
-
-// Intrusive_ptr stuff foward decl
-namespace phoenix{ class Droppable; }
-
-namespace boost{
-	//! Droppable intrusive_ptr reference increment function.
-    void intrusive_ptr_add_ref( phoenix::Droppable*);
-	//! Droppable intrusive_ptr reference decrement function.
-    void intrusive_ptr_release( phoenix::Droppable*);
-}
-
-
-namespace phoenix
-{
-
-//! Droppable object.
-/*!
-	Provides a simple abstract class for 'droppable' objects. Essentially
-	this eases the creating of garbage collected objects that are to be
-	iterated over. Derived classes should add themselves to their managers
-	recycle list to be garbage collected. Dropped objects are considered
-	deleted and should be skipped during iteration. It also provides
-    the facilities for intrusive_ptr to work on droppable objects.
-	\sa AbstractGarbageCollector
-*/
-class Droppable
-{
-
-public:
-
-	Droppable()
-		: _refcount(0), _dropped( false )
-	{}
-
-	virtual ~Droppable()
-	{
-	}
-
-	//! Drop
-	/*!
-		Sets this object to 'dropped', and does nothing else.
-		It is encourage that derived classes overload this,
-		and simply call it with Droppable::drop().
-	*/
-	inline virtual void drop()
-	{
-		_dropped = true;
-	}
-
-	//! Dropped
-	/*!
-		Returns if this object has been 'dropped', this
-		can be used by iterative lists that want to 
-		skip objects that have been listed to be deleted.
-	*/
-	inline bool dropped()
-	{
-		return _dropped;
-	}
-
-    //! Get reference count
-    inline unsigned int getReferenceCount(){ return _refcount; }
-
-
-private:
-
-    friend void boost::intrusive_ptr_add_ref( Droppable* );
-    friend void boost::intrusive_ptr_release( Droppable* );
-
-    unsigned int _refcount;
-	bool _dropped;
-
-}; //class droppable
-
-//! Friendly name for ptrs to droppables.
-typedef boost::intrusive_ptr< Droppable > DroppablePtr;
-
-} //namespace phoenix
-
-// Intrusive_ptr stuff 
-namespace boost{
-    inline void intrusive_ptr_add_ref( phoenix::Droppable* ptr ){ ++(ptr->_refcount); }
-    inline void intrusive_ptr_release( phoenix::Droppable* ptr ){
-		if( ptr->_refcount == 0 ) throw std::runtime_error("Invalid itrusive_ptr release on phoenix::Droppable");
-        if( (--ptr->_refcount) == 0){
-            delete ptr;
-        }
-    }
-}
-
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHDROPPABLE_H__
+#define __PHDROPPABLE_H__
+
+#include <stdexcept>
+#include <boost/intrusive_ptr.hpp>
+#include "config.h"
+
+#if PH_ATOMIC_REFCOUNT && defined(_MSC_VER)
+#include <intrin.h>
+#pragma intrinsic( _InterlockedIncrement, _InterlockedDecrement )
+#endif
+
+// Intrusive_ptr stuff foward decl
+namespace phoenix{ class Droppable; }
+
+namespace boost{
+	//! Droppable intrusive_ptr reference increment function.
+    void intrusive_ptr_add_ref( phoenix::Droppable*);
+	//! Droppable intrusive_ptr reference decrement function.
+    void intrusive_ptr_release( phoenix::Droppable*);
+}
+
+
+namespace phoenix
+{
+
+//! Droppable object.
+/*!
+	Provides a simple abstract class for 'droppable' objects. Essentially
+	this eases the creating of garbage collected objects that are to be
+	iterated over. Derived classes should add themselves to their managers
+	recycle list to be garbage collected. Dropped objects are considered
+	deleted and should be skipped during iteration. It also provides
+    the facilities for intrusive_ptr to work on droppable objects.
+	\sa AbstractGarbageCollector
+*/
+class Droppable
+{
+
+public:
+
+	Droppable()
+		: _refcount(0), _dropped( false )
+	{}
+
+	virtual ~Droppable()
+	{
+	}
+
+	//! Drop
+	/*!
+		Sets this object to 'dropped', and does nothing else.
+		It is encourage that derived classes overload this,
+		and simply call it with Droppable::drop().
+	*/
+	inline virtual void drop()
+	{
+		_dropped = true;
+	}
+
+	//! Dropped
+	/*!
+		Returns if this object has been 'dropped', this
+		can be used by iterative lists that want to 
+		skip objects that have been listed to be deleted.
+	*/
+	inline bool dropped()
+	{
+		return _dropped;
+	}
+
+    //! Get reference count
+    inline unsigned int getReferenceCount(){ return (unsigned int) loadReference( _refcount ); }
+
+protected:
+
+	//! Revive
+	/*!
+		Clears the 'dropped' state, for managers that recycle objects
+		instead of deleting them.
+	*/
+	inline void revive()
+	{
+		_dropped = false;
+	}
+
+
+private:
+
+    friend void boost::intrusive_ptr_add_ref( Droppable* );
+    friend void boost::intrusive_ptr_release( Droppable* );
+
+	/*
+		Reference count operations. With PH_ATOMIC_REFCOUNT, taking a reference is relaxed since
+		whoever hands over a pointer already holds one, and letting one go is acquire-release so
+		everything done through the pointer happens before the delete.
+	*/
+#if ! PH_ATOMIC_REFCOUNT
+	typedef int Count;
+	static inline long loadReference( const Count& _c ) { return _c; }
+	static inline long incrementReference( Count& _c ) { return ++_c; }
+	static inline long decrementReference( Count& _c ) { return --_c; }
+#elif defined(_MSC_VER)
+	typedef long volatile Count;
+	static inline long loadReference( const Count& _c ) { return _c; }
+	static inline long incrementReference( Count& _c ) { return _InterlockedIncrement( &_c ); }
+	static inline long decrementReference( Count& _c ) { return _InterlockedDecrement( &_c ); }
+#elif defined(__clang__) || ( defined(__GNUC__) && ( __GNUC__ > 4 || ( __GNUC__ == 4 && __GNUC_MINOR__ >= 7 ) ) )
+	typedef int Count;
+	static inline long loadReference( const Count& _c ) { return __atomic_load_n( &_c, __ATOMIC_RELAXED ); }
+	static inline long incrementReference( Count& _c ) { return __atomic_add_fetch( &_c, 1, __ATOMIC_RELAXED ); }
+	static inline long decrementReference( Count& _c ) { return __atomic_sub_fetch( &_c, 1, __ATOMIC_ACQ_REL ); }
+#elif defined(__GNUC__)
+	// Older GCC only has the full barrier builtins.
+	typedef int volatile Count;
+	static inline long loadReference( const Count& _c ) { return _c; }
+	static inline long incrementReference( Count& _c ) { return __sync_add_and_fetch( &_c, 1 ); }
+	static inline long decrementReference( Count& _c ) { return __sync_sub_and_fetch( &_c, 1 ); }
+#else
+#error "PH_ATOMIC_REFCOUNT isn't supported with this compiler, define it as 0."
+#endif
+
+    Count _refcount;
+	bool _dropped;
+
+}; //class droppable
+
+//! Friendly name for ptrs to droppables.
+typedef boost::intrusive_ptr< Droppable > DroppablePtr;
+
+} //namespace phoenix
+
+// Intrusive_ptr stuff 
+namespace boost{
+    inline void intrusive_ptr_add_ref( phoenix::Droppable* ptr ){ phoenix::Droppable::incrementReference( ptr->_refcount ); }
+    inline void intrusive_ptr_release( phoenix::Droppable* ptr ){
+		if( phoenix::Droppable::loadReference( ptr->_refcount ) == 0 ) throw std::runtime_error("Invalid itrusive_ptr release on phoenix::Droppable");
+        if( phoenix::Droppable::decrementReference( ptr->_refcount ) == 0){
+            delete ptr;
+        }
+    }
+}
+
 #endif //__PHDROPPABLE_H__
\ No newline at end of file
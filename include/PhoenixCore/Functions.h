@@ -1,33 +1,70 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-#ifndef __PHOENIXFUNCS__
-#define __PHOENIXFUNCS__
-
-#include <cstdlib> //For rand()
-#include "config.h"
-
-namespace phoenix
-{
-
-    //! Random function.
-	/*!
-		\param low The lowest possible value.
-		\param high The highest possible value.
-		\return A pseudo random value between low and high.
-	*/
-	///random function
-	inline int random(int low,int high)
-	{
-		return ( rand() % (high - low + 1) + low);
-	}
-
-} //namespace phoenix
-
-#endif //__PHOENIXFUNCS__
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHOENIXFUNCS__
+#define __PHOENIXFUNCS__
+
+#include <cstdlib> //For rand()
+#include <cstddef>
+#include "config.h"
+
+namespace phoenix
+{
+
+    //! Random function.
+	/*!
+		\param low The lowest possible value.
+		\param high The highest possible value.
+		\return A pseudo random value between low and high.
+	*/
+	///random function
+	inline int random(int low,int high)
+	{
+		return ( rand() % (high - low + 1) + low);
+	}
+
+	//! UTF-8 decoder.
+	/*!
+		Decodes one character and advances the iterator past it.
+		Bytes that don't start a valid sequence are returned as they are (as Latin-1),
+		so text that isn't UTF-8 still draws the same as it always has.
+		\param _it Iterator to the first byte of the character.
+		\param _end End of the text.
+		\return The unicode code point.
+	*/
+	inline unsigned int decodeUtf8( const char*& _it, const char* _end )
+	{
+		const unsigned char c = *_it++;
+		if( c < 0x80 ) return c;
+
+		unsigned int n, cp;
+		if( (c & 0xE0) == 0xC0 ) { n = 1; cp = c & 0x1F; }
+		else if( (c & 0xF0) == 0xE0 ) { n = 2; cp = c & 0x0F; }
+		else if( (c & 0xF8) == 0xF0 ) { n = 3; cp = c & 0x07; }
+		else return c;
+
+		if( _end - _it < (std::ptrdiff_t) n ) return c;
+		for( unsigned int i = 0; i < n; ++i )
+		{
+			const unsigned char b = _it[i];
+			if( (b & 0xC0) != 0x80 ) return c;
+			cp = (cp << 6) | (b & 0x3F);
+		}
+
+		// Overlong encodings and values past the unicode range aren't valid.
+		static const unsigned int smallest[4] = { 0, 0x80, 0x800, 0x10000 };
+		if( cp < smallest[n] || cp > 0x10FFFF ) return c;
+
+		_it += n;
+		return cp;
+	}
+
+} //namespace phoenix
+
+#endif //__PHOENIXFUNCS__
@@ -0,0 +1,246 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHGLSTATE_H__
+#define __PHGLSTATE_H__
+
+#include <cstring>
+#include <boost/unordered_map.hpp>
+#include "config.h"
+
+namespace phoenix
+{
+
+//! OpenGL State Cache
+/*!
+	Keeps track of the OpenGL state phoenix changes the most (enabled capabilities and client arrays, the texture bound
+	to each unit, the shader program, the framebuffer, the blend function, the scissor box, the viewport, and the
+	modelview matrix) and skips calls that wouldn't change anything. Everything in phoenix that sets this state goes
+	through here.
+
+	Code that changes any of this state directly, such as a GroupState that calls glBindTexture() itself, should call
+	invalidate() when it's done, so that later calls aren't skipped when they shouldn't be.
+
+	There's only one OpenGL context, so this is all static. Like the rest of OpenGL, it should only be used from the
+	thread that draws.
+	\sa getCallCount(), getFilteredCount()
+*/
+class GLState
+{
+
+public:
+
+	//! The number of texture units that are tracked.
+	static const unsigned int TEXTURE_UNITS = 8;
+
+	//! Enables or disables a capability (glEnable()/glDisable()).
+	inline static void setEnabled( const GLenum _cap, const bool _on )
+	{
+		boost::unordered_map< GLenum, bool >::iterator it = enabled.find( _cap );
+		if( skip( it != enabled.end() && it->second == _on ) ) return;
+		_on ? glEnable( _cap ) : glDisable( _cap );
+		enabled[ _cap ] = _on;
+	}
+
+	//! Enables a capability.
+	inline static void enable( const GLenum _cap ) { setEnabled( _cap, true ); }
+
+	//! Disables a capability.
+	inline static void disable( const GLenum _cap ) { setEnabled( _cap, false ); }
+
+	//! Enables or disables a client array (glEnableClientState()/glDisableClientState()).
+	inline static void setClientState( const GLenum _array, const bool _on )
+	{
+		boost::unordered_map< GLenum, bool >::iterator it = client_states.find( _array );
+		if( skip( it != client_states.end() && it->second == _on ) ) return;
+		_on ? glEnableClientState( _array ) : glDisableClientState( _array );
+		client_states[ _array ] = _on;
+	}
+
+	//! Binds a 2D texture to a texture unit.
+	inline static void bindTexture( const GLuint _texture, const unsigned int _unit = 0 )
+	{
+		if( _unit >= TEXTURE_UNITS )
+		{
+			++calls;
+			activeTexture( _unit );
+			glBindTexture( GL_TEXTURE_2D, _texture );
+			return;
+		}
+		if( skip( textures_known[_unit] && textures[_unit] == _texture ) ) return;
+		activeTexture( _unit );
+		glBindTexture( GL_TEXTURE_2D, _texture );
+		textures[_unit] = _texture;
+		textures_known[_unit] = true;
+	}
+
+	//! Gets the texture bound to a unit, or 0 if it isn't known.
+	inline static GLuint getBoundTexture( const unsigned int _unit = 0 )
+	{
+		return _unit < TEXTURE_UNITS && textures_known[_unit] ? textures[_unit] : 0;
+	}
+
+	//! Forgets a texture that's being deleted, wherever it's bound.
+	static void forgetTexture( const GLuint _texture );
+
+	//! Forgets which textures are bound, for after something else (like SOIL) has bound textures.
+	static void forgetTextures();
+
+	//! Makes a shader program current (glUseProgram()).
+	inline static void useProgram( const GLuint _program )
+	{
+		if( skip( program_known && program == _program ) ) return;
+		glUseProgram( _program );
+		program = _program;
+		program_known = true;
+	}
+
+	//! Checks if a shader program is known to be current.
+	inline static bool isCurrentProgram( const GLuint _program ) { return program_known && program == _program; }
+
+	//! Forgets a shader program that's being deleted.
+	static void forgetProgram( const GLuint _program );
+
+	//! Binds a framebuffer object (glBindFramebufferEXT()), 0 is the window.
+	inline static void bindFramebuffer( const GLuint _fbo )
+	{
+		if( skip( framebuffer_known && framebuffer == _fbo ) ) return;
+		glBindFramebufferEXT( GL_FRAMEBUFFER_EXT, _fbo );
+		framebuffer = _fbo;
+		framebuffer_known = true;
+	}
+
+	//! Forgets a framebuffer object that's being deleted.
+	static void forgetFramebuffer( const GLuint _fbo );
+
+	//! Sets the blend function (glBlendFunc()).
+	inline static void blendFunc( const GLenum _src, const GLenum _dst )
+	{
+		if( skip( blend_known && blend_src == _src && blend_dst == _dst ) ) return;
+		glBlendFunc( _src, _dst );
+		blend_src = _src;
+		blend_dst = _dst;
+		blend_known = true;
+	}
+
+	//! Sets the scissor box (glScissor()).
+	inline static void scissor( const GLint _x, const GLint _y, const GLsizei _w, const GLsizei _h )
+	{
+		if( skip( scissor_known && scissor_box[0] == _x && scissor_box[1] == _y && scissor_box[2] == _w && scissor_box[3] == _h ) ) return;
+		glScissor( _x, _y, _w, _h );
+		scissor_box[0] = _x; scissor_box[1] = _y; scissor_box[2] = _w; scissor_box[3] = _h;
+		scissor_known = true;
+	}
+
+	//! Sets the viewport (glViewport()).
+	inline static void viewport( const GLint _x, const GLint _y, const GLsizei _w, const GLsizei _h )
+	{
+		if( skip( viewport_known && viewport_box[0] == _x && viewport_box[1] == _y && viewport_box[2] == _w && viewport_box[3] == _h ) ) return;
+		glViewport( _x, _y, _w, _h );
+		viewport_box[0] = _x; viewport_box[1] = _y; viewport_box[2] = _w; viewport_box[3] = _h;
+		viewport_known = true;
+	}
+
+	//! Gets the viewport (x, y, width, height), asking OpenGL for it only if it isn't known.
+	static const GLint* getViewport();
+
+	//! Sets the current matrix stack (glMatrixMode()).
+	inline static void matrixMode( const GLenum _mode )
+	{
+		if( skip( matrix_mode_known && matrix_mode == _mode ) ) return;
+		glMatrixMode( _mode );
+		matrix_mode = _mode;
+		matrix_mode_known = true;
+	}
+
+	//! Loads a column-major matrix into the modelview matrix (glLoadMatrixf()), leaving the matrix mode as GL_MODELVIEW.
+	/*!
+		This is skipped if it's the matrix that's already loaded. Pushing and popping the modelview matrix around drawing
+		doesn't change that, but anything that loads, multiplies, or pops a different matrix should call forgetModelview().
+	*/
+	inline static void loadModelview( const GLfloat* _m )
+	{
+		matrixMode( GL_MODELVIEW );
+		if( skip( modelview_known && std::memcmp( modelview, _m, sizeof( modelview ) ) == 0 ) ) return;
+		glLoadMatrixf( _m );
+		std::memcpy( modelview, _m, sizeof( modelview ) );
+		modelview_known = true;
+	}
+
+	//! Forgets the modelview matrix, for after it's been changed some other way.
+	inline static void forgetModelview() { modelview_known = false; }
+
+	//! Forgets everything, so the next call for each piece of state goes through to OpenGL.
+	static void invalidate();
+
+	//! Gets the number of calls made through the cache since the counts were last reset.
+	inline static unsigned int getCallCount() { return calls; }
+
+	//! Gets how many of those calls were skipped because they wouldn't have changed anything.
+	inline static unsigned int getFilteredCount() { return filtered; }
+
+	//! Resets the call counts.
+	inline static void resetCounts() { calls = filtered = 0; }
+
+private:
+
+	//! Counts a call, and whether it was skipped.
+	inline static bool skip( const bool _redundant )
+	{
+		++calls;
+		if( _redundant ) ++filtered;
+		return _redundant;
+	}
+
+	//! Makes a texture unit active.
+	inline static void activeTexture( const unsigned int _unit )
+	{
+		if( active_unit_known && active_unit == _unit ) return;
+		if( GLEW_VERSION_1_3 ) glActiveTexture( GL_TEXTURE0 + _unit );
+		active_unit = _unit;
+		active_unit_known = true;
+	}
+
+	static boost::unordered_map< GLenum, bool > enabled;
+	static boost::unordered_map< GLenum, bool > client_states;
+
+	static GLuint textures[ TEXTURE_UNITS ];
+	static bool textures_known[ TEXTURE_UNITS ];
+	static unsigned int active_unit;
+	static bool active_unit_known;
+
+	static GLuint program;
+	static bool program_known;
+
+	static GLuint framebuffer;
+	static bool framebuffer_known;
+
+	static GLenum blend_src, blend_dst;
+	static bool blend_known;
+
+	static GLint scissor_box[4];
+	static bool scissor_known;
+
+	static GLint viewport_box[4];
+	static bool viewport_known;
+
+	static GLenum matrix_mode;
+	static bool matrix_mode_known;
+
+	static GLfloat modelview[16];
+	static bool modelview_known;
+
+	static unsigned int calls;
+	static unsigned int filtered;
+
+}; // class GLState
+
+} //namespace phoenix
+
+#endif //__PHGLSTATE_H__
@@ -1,62 +1,74 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-
-#ifndef __PHGROUPSTATE_H__
-#define __PHGROUPSTATE_H__
-
-#include "config.h"
-#include "boost/shared_ptr.hpp"
-
-namespace phoenix{
-
-// forward decl
-class BatchRenderer;
-
-//! Group State Manager
-/*!
-	This is an abstract interface for objects that manipulate the render
-	state for a specific group of geometry. These objects are added to a
-	BatchRenderer using the BatchRenderer::addGroupState() and removed using
-	BatchRenderer::removeGroupState(). Only one state object can be applied
-	to a group at a time, if more are needed, applying the Composite pattern
-	should be considered.
-*/
-class GroupState
-{
-
-public:
-
-	GroupState(){};
-	virtual ~GroupState(){};
-
-	//! Begin render state.
-	/*!
-		Should set up all the render states needed for the current group.
-		BatchRenderer will pass a reference to itself.
-	*/
-	virtual void begin( BatchRenderer& r ) = 0;
-
-	//! End render state.
-	/*!
-		Should restore the render state. Failure to do so properly
-		could result in the remaining geometry groups not appearing
-		correctly.
-		BatchRenderer will pass a reference to itself.
-	*/
-	virtual void end( BatchRenderer& r ) = 0;
-
-}; // class
-
-//! Friendly name for GroupState objects.
-typedef boost::shared_ptr<GroupState> GroupStatePtr;
-
-} //namespace phoenix
-
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+
+#ifndef __PHGROUPSTATE_H__
+#define __PHGROUPSTATE_H__
+
+#include "config.h"
+#include "boost/shared_ptr.hpp"
+
+namespace phoenix{
+
+// forward decl
+class BatchRenderer;
+
+//! Group State Manager
+/*!
+	This is an abstract interface for objects that manipulate the render
+	state for a specific group of geometry. These objects are added to a
+	BatchRenderer using the BatchRenderer::addGroupState() and removed using
+	BatchRenderer::removeGroupState(). Only one state object can be applied
+	to a group at a time, if more are needed, applying the Composite pattern
+	should be considered.
+*/
+class GroupState
+{
+
+public:
+
+	GroupState(){};
+	virtual ~GroupState(){};
+
+	//! Begin render state.
+	/*!
+		Should set up all the render states needed for the current group.
+		BatchRenderer will pass a reference to itself.
+		State that GLState keeps track of should be set through it, or GLState::invalidate() called afterwards.
+	*/
+	virtual void begin( BatchRenderer& r ) = 0;
+
+	//! End render state.
+	/*!
+		Should restore the render state. Failure to do so properly
+		could result in the remaining geometry groups not appearing
+		correctly.
+		BatchRenderer will pass a reference to itself.
+	*/
+	virtual void end( BatchRenderer& r ) = 0;
+
+	//! Checks if this state leaves the render state the same as _other.
+	/*!
+		When the renderer goes straight from a group with _other's state to a group with this
+		state (including this state at the next depth), and this returns true, it skips calling
+		_other's end() and this state's begin(). States that set the same render state every time
+		can return true for themselves, and for other states that set the same thing. The
+		default is false, so begin() and end() are always called.
+		\sa BatchRenderer::getElidedGroupSwitches()
+	*/
+	virtual bool isEquivalent( const GroupState& /*_other*/ ) const { return false; }
+
+}; // class
+
+//! Friendly name for GroupState objects.
+typedef boost::shared_ptr<GroupState> GroupStatePtr;
+
+} //namespace phoenix
+
 #endif //__PHGROUPSTATE_H__
\ No newline at end of file
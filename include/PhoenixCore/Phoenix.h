@@ -1,29 +1,37 @@
-/*
-  Phoenix Core Include File.
-  This file #includes all of
-  Phoenix's headers.
-*/
-
-#include "config.h"
-#include "Shader.h"
-#include "GroupState.h"
-#include "BatchGeometry.h"
-#include "BatchRenderer.h"
-#include "ShaderGroupState.h"
-#include "BitmapFont.h"
-#include "Color.h"
-#include "DebugConsole.h"
-#include "EventReceiver.h"
-#include "Polygon.h"
-#include "Rectangle.h"
-#include "RenderSystem.h"
-#include "RenderTarget.h"
-#include "Resource.h"
-#include "ResourceManager.h"
-#include "RotationMatrix.h"
-#include "Texture.h"
-#include "Timer.h"
-#include "Vector2d.h"
-#include "View.h"
-#include "WindowManager.h"
+/*
+  Phoenix Core Include File.
+  This file #includes all of
+  Phoenix's headers.
+*/
+
+#include "config.h"
+#include "AssetPack.h"
+#include "Shader.h"
+#include "GroupState.h"
+#include "BatchGeometry.h"
+#include "BatchRenderer.h"
+#include "ShaderGroupState.h"
+#include "BitmapFont.h"
+#include "Color.h"
+#include "DebugConsole.h"
+#include "DistanceField.h"
+#include "EventReceiver.h"
+#include "GLState.h"
+#include "Polygon.h"
+#include "Rectangle.h"
+#include "RenderSystem.h"
+#include "RenderTarget.h"
+#include "RenderTargetPool.h"
+#include "Resource.h"
+#include "ResourceManager.h"
+#include "RotationMatrix.h"
+#include "Texture.h"
+#include "TextGeometry.h"
+#include "TextureReadback.h"
+#include "Timer.h"
+#include "TrackingInvariant.h"
+#include "Vector2d.h"
+#include "VertexTransform.h"
+#include "View.h"
+#include "WindowManager.h"
 #include "Functions.h"
\ No newline at end of file
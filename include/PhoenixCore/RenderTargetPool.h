@@ -0,0 +1,144 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHRENDERTARGETPOOL_H__
+#define __PHRENDERTARGETPOOL_H__
+
+#include <map>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include "config.h"
+#include "RenderTarget.h"
+
+namespace phoenix
+{
+
+	//! Render Target Pool
+	/*!
+		Hands out render targets for temporary passes (blurs, post effects, and the like) and takes them
+		back when they're done with, so the framebuffer objects and textures are made once and used again
+		on later frames instead of being created and destroyed every frame.
+
+		Targets are kept by size and texture format. acquire() gives back a released target with the same
+		size and format if there is one, and only makes a new one when there isn't. A target shouldn't be
+		released until nothing that's still to be drawn uses its texture, because the next acquire() can
+		draw over it.
+		\sa RenderTarget
+	*/
+	class RenderTargetPool
+		: boost::noncopyable
+	{
+
+	public:
+
+		//! Constructor
+		RenderTargetPool( ResourceManager& _r )
+			: rmanager( _r ), free_targets(), slots(), free_count( 0 ), allocations( 0 ), reuses( 0 )
+		{}
+
+		//! Destructor
+		/*!
+			Drops the targets that are in the pool. Targets that are still acquired are left alone.
+		*/
+		virtual ~RenderTargetPool() { clear(); }
+
+		//! Gets a render target with a color texture of the given size and internal format.
+		RenderTargetPtr acquire( const Vector2d& _size, GLenum _format = GL_RGBA );
+
+		//! Gives a render target back to the pool, so that it can be acquired again.
+		/*!
+			Targets that didn't come from this pool's acquire(), or that are already back in the pool, are
+			ignored. A target that was dropped while it was acquired is forgotten, along with its texture.
+		*/
+		void release( RenderTargetPtr _target );
+
+		//! Drops the targets in the pool that haven't been acquired in the given number of frames.
+		/*!
+			Calling this once a frame keeps targets for effects that have stopped running from using
+			video memory forever. Acquired targets that have been dropped are forgotten too.
+			\sa ResourceManager::getFrame()
+		*/
+		void trim( unsigned int _frames );
+
+		//! Drops all of the targets in the pool, and forgets acquired targets that have been dropped.
+		void clear();
+
+		//! Gets the number of targets in the pool that are waiting to be acquired.
+		inline unsigned int getFreeCount() const { return free_count; }
+
+		//! Gets the number of render targets (and textures) this pool has made.
+		inline unsigned int getAllocations() const { return allocations; }
+
+		//! Gets the number of times acquire() was able to give back a target from the pool instead of making one.
+		inline unsigned int getReuses() const { return reuses; }
+
+		//! Resets the allocation and reuse counts.
+		inline void resetCounts() { allocations = reuses = 0; }
+
+	protected:
+
+		//! What targets are kept by.
+		struct Key
+		{
+			Key( int _w, int _h, GLenum _f ) : width( _w ), height( _h ), format( _f ) {}
+
+			bool operator<( const Key& _o ) const
+			{
+				if( width != _o.width ) return width < _o.width;
+				if( height != _o.height ) return height < _o.height;
+				return format < _o.format;
+			}
+
+			int width, height;
+			GLenum format;
+		};
+
+		//! A target in the pool, and the frame it was released on.
+		struct Entry
+		{
+			Entry( RenderTargetPtr _t, unsigned int _f ) : target( _t ), frame( _f ) {}
+
+			RenderTargetPtr target;
+			unsigned int frame;
+		};
+
+		//! A target this pool has made, what it was asked for with, and if it's in the pool or acquired.
+		struct Slot
+		{
+			Slot( RenderTargetPtr _t, const Key& _k ) : target( _t ), key( _k ), free( false ) {}
+
+			RenderTargetPtr target;
+			Key key;
+			bool free;
+		};
+
+		typedef std::map< Key, std::vector< Entry > > FREEMAP;
+		typedef std::map< RenderTarget*, Slot > SLOTMAP;
+
+		//! Drops a target and its texture, and forgets it.
+		void drop( RenderTargetPtr _target );
+
+		//! Forgets acquired targets that have been dropped, and drops their textures.
+		void forgetDropped();
+
+		ResourceManager& rmanager;
+		FREEMAP free_targets;
+
+		//! Every target this pool has made that hasn't been dropped, the slot keeps a reference so the address isn't reused.
+		SLOTMAP slots;
+		unsigned int free_count;
+
+		unsigned int allocations;
+		unsigned int reuses;
+
+	}; // class RenderTargetPool
+
+} //namespace phoenix
+
+#endif //__PHRENDERTARGETPOOL_H__
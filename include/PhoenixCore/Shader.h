@@ -1,106 +1,195 @@
-/*
-
-Copyright (c) 2011, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-#ifndef __PHSHADER_H__
-#define __PHSHADER_H__
-
-#include <string>
-#include "config.h"
-#include "Resource.h"
-#include "Texture.h"
-
-namespace phoenix
-{
-
-    class Color;
-//! Basic OpenGL Shader Interface
-/*! 
-	Provides basic utility to load, compile, and use shaders. As phoenix is designed around the FFP and for simplicity, this class
-	isn't designed to be the ultimate shader interface. It does not provide facilities for custom uniforms or vertex attributes. 
-	If you're interest in using those you're welcome to use getProgramId() and to overload BatchGeometry, etc. 
-*/
-class Shader
-	: public Resource
-{
-
-public:
-
-	Shader( ResourceManager& _r )
-		: Resource(_r, ERT_SHADER), vertex_shader(0), fragment_shader(0), shader_program(0)
-	{}
-
-	virtual ~Shader();
-
-	//! Checks if the shader is ready
-	inline const bool ready(){
-		return ( GLEW_VERSION_2_0 && vertex_shader && fragment_shader && shader_program );
-	}
-
-	//! Makes the shader the currently active shader program, will activate the default (ffp) program if this shader isn't ready.
-	void activate();
-
-	//! Activates FFP
-	void deactivate();
-
-    //! Sets a uniform inside the shader
-    void setUniform( const std::string &uniform_name, const int value );
-    void setUniform( const std::string &uniform_name, const float value );
-    void setUniform( const std::string &uniform_name, const Vector2d &value );
-    void setUniform( const std::string &uniform_name, const Color &value);
-    void setUniform( const std::string &uniform_name, TexturePtr value );    
-    
-    //! Get a shader uniform. 
-    int getUniform( const std::string &uniform_name );
-
-	//! Loads shader files, compiles them and links them
-	bool load( const std::string& vertex_file, const std::string& fragment_file );
-
-	//! Loads shaders from a string, compiles, and links them */
-	bool loadFromString( const std::string& vertex_source, const std::string& fragment_source );
-
-	//! Compiles a specific shader, usually not called directly
-	GLuint compile( GLenum _type, const std::string& _source );
-
-	//! Links the shader program, usually not called directly
-	GLuint link();
-
-	//! Gets all of the errors that may have occured during compiling/linking.
-	inline const std::string& getErrors(){
-		return errors;
-	}
-
-	//! Get the shader program id
-	inline const GLuint& getProgramId(){ return shader_program; } 
-
-protected:
-	GLuint vertex_shader;
-	GLuint fragment_shader;
-	GLuint shader_program;
-	std::string errors;
-
-	//! Adds a string to the error log
-	void addError( const std::string& _error );
-
-	//! Retrieves errors from OpenGL
-	void show_info_log(
-		GLuint object,
-		PFNGLGETSHADERIVPROC glGet__iv,
-		PFNGLGETSHADERINFOLOGPROC glGet__InfoLog
-	);
-
-	//! Reads and entire file and returns it as a string
-	const std::string getFileContents( const std::string& file_name );
-
-}; // class Shader
-
-//! Friendly Shader pointer
-typedef boost::intrusive_ptr<Shader> ShaderPtr;
-
-} //namespace phoenix
-#endif // __PHSHADER_H__
+/*
+
+Copyright (c) 2011, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHSHADER_H__
+#define __PHSHADER_H__
+
+#include <string>
+#include <vector>
+#include <boost/unordered_map.hpp>
+#include "config.h"
+#include "Resource.h"
+#include "Texture.h"
+#include "AssetPack.h"
+
+namespace phoenix
+{
+
+    class Color;
+//! Basic OpenGL Shader Interface
+/*! 
+	Provides basic utility to load, compile, and use shaders. As phoenix is designed around the FFP and for simplicity, this class
+	isn't designed to be the ultimate shader interface. It does not provide facilities for custom vertex attributes. 
+	If you're interest in using those you're welcome to use getProgramId() and to overload BatchGeometry, etc. 
+
+	Uniform locations are looked up once, when the program is linked, and the last value set for each uniform is
+	kept so that setting it to the same thing again doesn't go to OpenGL. Values set while the shader isn't active are
+	sent when it's next activated. For uniforms set often, getUniformHandle() gives a handle that skips the lookup by name.
+*/
+class Shader
+	: public Resource
+{
+
+public:
+
+	Shader( ResourceManager& _r )
+		: Resource(_r, ERT_SHADER), vertex_shader(0), fragment_shader(0), shader_program(0), uniform_handles(), uniforms()
+	{}
+
+	virtual ~Shader();
+
+	//! Checks if the shader is ready (a program loaded from the program cache has no shader objects)
+	inline const bool ready(){
+		return ( GLEW_VERSION_2_0 && shader_program );
+	}
+
+	//! Makes the shader the currently active shader program, will activate the default (ffp) program if this shader isn't ready.
+	void activate();
+
+	//! Activates FFP
+	void deactivate();
+
+    //! Sets a uniform inside the shader
+    void setUniform( const std::string &uniform_name, const int value );
+    void setUniform( const std::string &uniform_name, const float value );
+    void setUniform( const std::string &uniform_name, const Vector2d &value );
+    void setUniform( const std::string &uniform_name, const Color &value);
+    void setUniform( const std::string &uniform_name, TexturePtr value );    
+
+    //! Sets a uniform by its handle (see getUniformHandle()).
+    void setUniform( const int handle, const int value );
+    void setUniform( const int handle, const float value );
+    void setUniform( const int handle, const Vector2d &value );
+    void setUniform( const int handle, const Color &value );
+    void setUniform( const int handle, TexturePtr value );
+    
+    //! Get the location of a shader uniform, -1 if it isn't there.
+    int getUniform( const std::string &uniform_name );
+
+    //! Gets a handle for a uniform that can be passed to setUniform() instead of its name.
+    /*!
+        Handles stay good until the shader is linked again. Setting a uniform the shader doesn't have does nothing.
+    */
+    int getUniformHandle( const std::string &uniform_name );
+
+	//! Loads shader files, compiles them and links them
+	bool load( const std::string& vertex_file, const std::string& fragment_file );
+
+	//! Loads shaders from a string, compiles, and links them */
+	bool loadFromString( const std::string& vertex_source, const std::string& fragment_source );
+
+	//! Loads shaders from an asset pack, compiling them straight from the mapped data, and links them
+	bool load( const AssetPack& _pack, const std::string& vertex_file, const std::string& fragment_file );
+
+	//! Compiles a specific shader, usually not called directly
+	GLuint compile( GLenum _type, const std::string& _source );
+
+	//! Compiles a specific shader from a range of characters, usually not called directly
+	GLuint compile( GLenum _type, const char* _source, const int _length );
+
+	//! Links the shader program, usually not called directly
+	GLuint link();
+
+	//! Gets all of the errors that may have occured during compiling/linking.
+	inline const std::string& getErrors(){
+		return errors;
+	}
+
+	//! Get the shader program id
+	inline const GLuint& getProgramId(){ return shader_program; } 
+
+	//! Sets the directory linked programs are cached in.
+	/*!
+		When set, the load functions look for a program binary saved from the same sources with the same OpenGL
+		vendor, renderer, and version, and use it instead of compiling. If there isn't one, or the driver turns it
+		down, the shaders are compiled and linked as usual and the program is saved for next time. This needs
+		OpenGL 4.1 or ARB_get_program_binary, otherwise nothing is cached. If empty (default), nothing is cached.
+		\note Must end with a path separator.
+	*/
+	inline static void setProgramCacheDirectory( const std::string& _d = std::string() ) { program_cache_dir = _d; }
+
+	//! Gets the program cache directory.
+	inline static const std::string& getProgramCacheDirectory() { return program_cache_dir; }
+
+	//! Gets the file the program for these sources is cached in, empty if programs aren't being cached.
+	static std::string getProgramCachePath( const char* vertex_source, const int vertex_length, const char* fragment_source, const int fragment_length );
+
+protected:
+	GLuint vertex_shader;
+	GLuint fragment_shader;
+	GLuint shader_program;
+	std::string errors;
+
+	//! A uniform's location, and the last value it was set to.
+	struct Uniform
+	{
+		GLint location;
+
+		//! The number of float components set (1, 2, or 4), or 0 for an int.
+		unsigned char components;
+
+		//! If a value has been set at all, and if it hasn't been sent to OpenGL yet.
+		bool set;
+		bool dirty;
+
+		GLint ivalue;
+		GLfloat fvalue[4];
+	};
+
+	//! Handles by name, and the uniforms the handles index.
+	boost::unordered_map< std::string, int > uniform_handles;
+	std::vector< Uniform > uniforms;
+
+	//! Directory for cached program binaries.
+	static std::string program_cache_dir;
+
+	//! Checks if program binaries can be cached.
+	static bool programBinariesSupported();
+
+	//! Compiles and links the shaders, using the program cache if it's on.
+	bool build( const char* vertex_source, const int vertex_length, const char* fragment_source, const int fragment_length );
+
+	//! Loads a linked program from the program cache.
+	bool loadProgramBinary( const std::string& _path );
+
+	//! Saves the linked program to the program cache.
+	bool saveProgramBinary( const std::string& _path );
+
+	//! Finds the active uniforms after linking, so their locations don't have to be looked up later.
+	void findUniforms();
+
+	//! Sets an int uniform's value, sending it if it changed and the shader is active.
+	void setUniformValue( const int handle, const GLint value );
+
+	//! Sets a float uniform's value, sending it if it changed and the shader is active.
+	void setUniformValue( const int handle, const GLfloat* value, const unsigned char components );
+
+	//! Sends a uniform's value to OpenGL.
+	void uploadUniform( Uniform& u );
+
+	//! Adds a string to the error log
+	void addError( const std::string& _error );
+
+	//! Retrieves errors from OpenGL
+	void show_info_log(
+		GLuint object,
+		PFNGLGETSHADERIVPROC glGet__iv,
+		PFNGLGETSHADERINFOLOGPROC glGet__InfoLog
+	);
+
+	//! Reads and entire file and returns it as a string
+	const std::string getFileContents( const std::string& file_name );
+
+}; // class Shader
+
+//! Friendly Shader pointer
+typedef boost::intrusive_ptr<Shader> ShaderPtr;
+
+} //namespace phoenix
+#endif // __PHSHADER_H__
@@ -0,0 +1,162 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHTEXTGEOMETRY_H__
+#define __PHTEXTGEOMETRY_H__
+
+#include <string>
+#include <vector>
+#include "config.h"
+#include "BatchGeometryComposite.h"
+#include "BitmapFont.h"
+
+namespace phoenix
+{
+
+//! Retained Text Geometry.
+/*!
+	Text laid out once by a BitmapFont and kept as persistent geometry, with one child geometry per
+	font page. It only lays itself out again when the text, scale, or alignment change, moving and
+	recoloring are done on the existing vertices. When the text changes to a string of the same length
+	(such as a score or FPS counter) only the glyphs that changed are rewritten, in place. BitmapFont::drawText() uses this class for immediate text in fonts with more than one page.
+	\sa BitmapFont::createText()
+*/
+class TextGeometry
+	: public BatchGeometryComposite
+{
+
+public:
+
+	//! Constructor
+	/*!
+		Lays out the text right away.
+		\param _f The font to use.
+		\param _s The text.
+		\param _p The position of the top left corner.
+		\param _c The color.
+		\param _scale The scale, if (0,0) the font's scale is used.
+		\param _align The horizontal alignment of the lines.
+		\param _immediate Creates immediate geometry (see BatchGeometry::setImmediate()).
+	*/
+	TextGeometry( BitmapFontPtr _f, const std::string& _s = std::string(), const Vector2d& _p = Vector2d(0,0), const Color& _c = Color(255,255,255), const Vector2d& _scale = Vector2d(0,0), E_TEXT_ALIGNMENT _align = T_ALIGN_LEFT, bool _immediate = false );
+
+	virtual ~TextGeometry()
+	{
+	}
+
+	//! Set text.
+	/*!
+		Does nothing if the text hasn't changed.
+	*/
+	void setText( const std::string& _s );
+
+	//! Set text from a C string, this avoids allocating when updating counters.
+	void setText( const char* _s );
+
+	//! Get text.
+	inline const std::string& getText() const { return text; }
+
+	//! Moves the text, the vertices are translated in place.
+	void setPosition( const Vector2d& _p );
+
+	//! Get position.
+	inline const Vector2d& getPosition() const { return position; }
+
+	//! Recolors the text in place.
+	void setColor( const Color& _c );
+
+	//! Get color.
+	inline const Color& getColor() const { return color; }
+
+	//! Set scale, the text is laid out again if it changed.
+	void setTextScale( const Vector2d& _s );
+
+	//! Get scale.
+	inline const Vector2d& getTextScale() const { return text_scale; }
+
+	//! Set alignment, the text is laid out again if it changed.
+	void setAlignment( E_TEXT_ALIGNMENT _a );
+
+	//! Get alignment.
+	inline E_TEXT_ALIGNMENT getAlignment() const { return alignment; }
+
+	//! Gets the dimensions of the laid out text.
+	inline const Vector2d& getDimensions() const { return dimensions; }
+
+	//! Gets the font.
+	inline BitmapFontPtr getFont() const { return font; }
+
+	//! Gets the number of times the whole text has been laid out.
+	inline unsigned int getLayoutCount() const { return layout_count; }
+
+	//! Gets the number of times the text has been updated in place.
+	inline unsigned int getUpdateCount() const { return update_count; }
+
+protected:
+
+	//! Where a glyph was placed
+	typedef BitmapFont::Placement Placement;
+
+	//! Lays out the whole text.
+	void layout();
+
+	//! Tries to rewrite only the glyphs of the decoded text that differ from the current text.
+	bool updateInPlace();
+
+	//! Rewrites the four vertices of a glyph in place.
+	void writeGlyph( const Placement& _pl, unsigned int _cp );
+
+	//! Gets the horizontal offset of a line for the alignment.
+	float lineOffset( unsigned int _line ) const;
+
+	//! Font
+	BitmapFontPtr font;
+
+	//! Text
+	std::string text;
+
+	//! Code points of the text
+	std::vector< unsigned int > codepoints;
+
+	//! Code points of new text, kept to avoid allocating
+	std::vector< unsigned int > decoded;
+
+	//! Position
+	Vector2d position;
+
+	//! Color
+	Color color;
+
+	//! Scale
+	Vector2d text_scale;
+
+	//! Alignment
+	E_TEXT_ALIGNMENT alignment;
+
+	//! Dimensions
+	Vector2d dimensions;
+
+	//! Placement of each code point
+	std::vector< Placement > placements;
+
+	//! Width of each line
+	std::vector< float > line_widths;
+
+	//! Statistics
+	unsigned int layout_count;
+	unsigned int update_count;
+
+};
+
+//! Friendly TextGeometry pointer
+typedef boost::intrusive_ptr<TextGeometry> TextGeometryPtr;
+
+} //namespace phoenix
+
+#endif //__PHTEXTGEOMETRY_H__
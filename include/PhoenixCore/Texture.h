@@ -1,178 +1,298 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-#ifndef __PHOENIXTEX_H__
-#define __PHOENIXTEX_H__
-
-#include <string>
-#include <boost/noncopyable.hpp>
-#include "config.h"
-#include "Color.h"
-#include "Vector2d.h"
-#include "Resource.h"
-
-namespace phoenix
-{
-
-    //! Texture class.
-    /*!
-        Provides a high-level container for OpenGL Texture Objects. This class provides methods to create, bind, and
-		modify textures.
-    */
-    class Texture
-        : public Resource, boost::noncopyable
-    {
-
-        friend class Resource;
-
-	public:
-
-
-        //! Constructor
-        /*!
-            Constructor that creates a texture object with the given dimensions.
-            \param _t A resource manager (for garbage collection).
-            \param _s The size of the texture.
-            \note The resource type for Textures is always ERT_TEXTURE.
-        */
-        Texture(ResourceManager& t, const Vector2d& _s = Vector2d(0,0))
-			: Resource(t,1), texture(0), width(0), height(0), data(NULL) 
-        {
-            setName( "Untitled" );
-			build(_s);
-        }
-
-        //! Destructor
-        /*!
-            Destroys this texture object and deletes the OpenGL texture.
-        */
-        virtual ~Texture()
-		{
-			if (glIsTexture(texture))
-			{
-			   glDeleteTextures(1, &texture);
-			}
-			if (data!=NULL)
-			{
-				delete [] data;
-			}
-		}
-
-
-        //! Creates a solid texture with the given size and color.
-        virtual void build( const Vector2d& _s, const Color& _c = Color(255,255,255) );
-
-        //! Set texture ID.
-        /*!
-            Sets the OpenGL texture identifier of this texture. Should never be called directly by the user, but
-            can be used by custom image loading routines.
-        */
-        inline void setTextureId(GLuint _t) { texture = _t; }
-
-        //! Get the OpenGL texture identifier.
-        inline GLuint getTextureId() const { return texture; }
-
-        //! Changes the texture's width (Must be a power of 2).
-        inline void setWidth(int _w) { width = _w; }
-
-        //! Get the current width of the texture.
-        inline int getWidth() const { return width; }
-
-		//! Get write access to the data
-		inline GLubyte* getData(){ return data; }
-
-        //! Changes the texture's height (Must be a power of 2).
-        inline void setHeight(int _h) { height = _h; }
-
-        //! Get height.
-        inline int getHeight() const { return height; }
-
-        //! Get size.
-        inline const Vector2d getSize() const { return Vector2d( (float) width,  (float) height ); }
-
-        //! Set size.
-		/*!
-			\note Texture sizes must be a power of 2.
-			\note This is a dangerous function, as it doesn't tell opengl about the new size, therefore this is not a valid way to resize a texture.
-		*/
-        inline void setSize(const Vector2d& sz)
-        {
-			width = int(sz.getX());
-			height = int(sz.getY());
-		}
-
-        //! Lock.
-        /*!
-            Locks the texture. Before getPixel() or setPixel() can be called, this must be called first.
-            \return True if it was able to lock the texture.
-            \sa unlock(), setPixel(), getPixel()
-        */
-        bool lock();
-
-        //! Unlock.
-        /*!
-            Unlocks the texture. It transfers all the texture data back into video memory. This must be called
-            after the user is done modifying the texture with setPixel().
-            \sa lock(), setPixel(), getPixel()
-        */
-        void unlock();
-
-		//! Unlock (BGRA Version)
-		/*!
-			Uploads the texture to video memory assuming a BGRA format.
-			\note Advanced
-			\sa unlock()
-		*/
-		void unlock(bool BGRA);
-
-        //! Changes a pixel to the given color. lock() must be called before this is possible.
-        void setPixel( const Vector2d& _p, const Color& _c);
-
-        //! Gets the color of the given pixel. lock() must be called before this is possible.
-        const Color getPixel( const Vector2d& _p ) const;
-
-        //! Binds this texture as the current OpenGL texture use for drawing.
-        inline bool bind()
-		{
-			if (glIsTexture(texture)) //make sure this is a texture
-			{
-				glBindTexture(GL_TEXTURE_2D, texture); //set the texture
-				return true;
-			}
-			return false;
-		}
-
-        //! Makes a hard (separate) copy of the texture.
-		boost::intrusive_ptr<Texture> copy();
-
-	protected:
-
-        //! Pointer to the OpenGL Texture.
-        GLuint texture;
-
-        //! Width of the texture.
-        int width;
-
-        //! Height of the texture.
-        int height;
-
-        //! Data used during texture manipulation.
-        /*!
-            \sa lock(),unlock(),setPixel(),getPixel()
-        */
-        GLubyte* data;
-
-    };
-
-    //! Friendly name for texture pointers
-    typedef boost::intrusive_ptr<Texture> TexturePtr;
-
-}//namespace phoenix
-
-#endif //__PHOENIXTEX_H__
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHOENIXTEX_H__
+#define __PHOENIXTEX_H__
+
+#include <string>
+#include <boost/noncopyable.hpp>
+#include "config.h"
+#include "Color.h"
+#include "Vector2d.h"
+#include "Resource.h"
+#include "GLState.h"
+
+namespace phoenix
+{
+
+    class TextureReadback;
+
+    //! Texture class.
+    /*!
+        Provides a high-level container for OpenGL Texture Objects. This class provides methods to create, bind, and
+		modify textures.
+    */
+    class Texture
+        : public Resource, boost::noncopyable
+    {
+
+        friend class Resource;
+
+	public:
+
+
+        //! Constructor
+        /*!
+            Constructor that creates a texture object with the given dimensions.
+            \param _t A resource manager (for garbage collection).
+            \param _s The size of the texture.
+            \note The resource type for Textures is always ERT_TEXTURE.
+        */
+        Texture(ResourceManager& t, const Vector2d& _s = Vector2d(0,0))
+			: Resource(t,1), texture(0), width(0), height(0), data(NULL), internal_format(GL_RGBA), compressed(false), memory_usage(0), source(), source_flags(0), evicted(false), opaque(false)
+        {
+            setName( "Untitled" );
+			build(_s);
+        }
+
+        //! Destructor
+        /*!
+            Destroys this texture object and deletes the OpenGL texture.
+        */
+        virtual ~Texture()
+		{
+			if (glIsTexture(texture))
+			{
+			   GLState::forgetTexture(texture);
+			   glDeleteTextures(1, &texture);
+			}
+			if (data!=NULL)
+			{
+				delete [] data;
+			}
+		}
+
+
+        //! Creates a solid texture with the given size and color.
+        virtual void build( const Vector2d& _s, const Color& _c = Color(255,255,255) );
+
+        //! Makes room for a texture with the given size and internal format, without filling it in.
+        /*!
+            This is for textures that are drawn to, such as those attached to a RenderTarget, where
+            filling in each pixel first (like build() does) would be wasted.
+        */
+        void allocate( const Vector2d& _s, GLenum _format = GL_RGBA );
+
+        //! Set texture ID.
+        /*!
+            Sets the OpenGL texture identifier of this texture. Should never be called directly by the user, but
+            can be used by custom image loading routines.
+        */
+        inline void setTextureId(GLuint _t) { texture = _t; }
+
+        //! Get the OpenGL texture identifier.
+        inline GLuint getTextureId() const { return texture; }
+
+        //! Changes the texture's width (Must be a power of 2).
+        inline void setWidth(int _w) { width = _w; }
+
+        //! Get the current width of the texture.
+        inline int getWidth() const { return width; }
+
+		//! Get write access to the data
+		inline GLubyte* getData(){ return data; }
+
+        //! Changes the texture's height (Must be a power of 2).
+        inline void setHeight(int _h) { height = _h; }
+
+        //! Get height.
+        inline int getHeight() const { return height; }
+
+        //! Get size.
+        inline const Vector2d getSize() const { return Vector2d( (float) width,  (float) height ); }
+
+        //! Set size.
+		/*!
+			\note Texture sizes must be a power of 2.
+			\note This is a dangerous function, as it doesn't tell opengl about the new size, therefore this is not a valid way to resize a texture.
+		*/
+        inline void setSize(const Vector2d& sz)
+        {
+			width = int(sz.getX());
+			height = int(sz.getY());
+		}
+
+        //! Get the OpenGL internal format of the texture (GL_RGBA unless it was loaded compressed).
+        inline GLenum getInternalFormat() const { return internal_format; }
+
+        //! Checks if the texture is stored in a compressed format (such as DXT1 or DXT5).
+        inline bool isCompressed() const { return compressed; }
+
+        //! Checks if every pixel of the texture is fully opaque.
+        /*!
+            This is worked out when the texture is built or unlocked, and by RenderSystem::loadTexture() with
+            ETL_DETECT_OPAQUE, otherwise it's false. It's used to put textured geometry in the renderer's opaque pass.
+            \sa detectOpaque(), BatchGeometry::setOpaque()
+        */
+        inline bool getOpaque() const { return opaque; }
+
+        //! Marks the texture as opaque or not.
+        inline void setOpaque( bool _o ) { opaque = _o; }
+
+        //! Works out if the texture is opaque by reading its alpha back from OpenGL.
+        /*!
+            DXT1 textures without alpha are known to be opaque without reading them back.
+            \return getOpaque().
+        */
+        bool detectOpaque();
+
+        //! Get memory usage.
+        /*!
+            \return The number of bytes of video memory used by the texture's image, including its mipmaps.
+            Evicted textures use none.
+            \sa getUncompressedMemoryUsage(), queryFormat()
+        */
+        virtual boost::uint64_t getMemoryUsage() const { return evicted ? 0 : ( memory_usage ? memory_usage : getUncompressedMemoryUsage() ); }
+
+        //! Get the number of bytes the texture would use as uncompressed RGBA.
+        inline boost::uint64_t getUncompressedMemoryUsage() const { return (boost::uint64_t) width * height * 4; }
+
+        //! Query format.
+        /*!
+            Asks OpenGL for the size, internal format and storage size of the texture. This is called by
+            the texture loading routines, but can be used by custom image loading routines as well.
+        */
+        void queryFormat();
+
+        //! Set source.
+        /*!
+            Sets the file the texture was loaded from, textures with a source can be evicted when the
+            resource manager is over its memory budget. This is called by RenderSystem::loadTexture().
+            \param _fn The filename of the image.
+            \param _flags The SOIL flags to load it with.
+            \sa evict(), restore()
+        */
+        inline void setSource( const std::string& _fn, unsigned int _flags = 0 ) { source = _fn; source_flags = _flags; }
+
+        //! Get the file the texture was loaded from, empty if it wasn't loaded from a file.
+        inline const std::string& getSource() const { return source; }
+
+        //! Evict.
+        /*!
+            Frees the texture's video memory, leaving a single pixel image in its place. The texture
+            keeps its id, size and parameters, and is reloaded from its source the next time it is bound.
+            \return False if the texture has no source, has been modified, or is already evicted.
+            \sa restore(), ResourceManager::setMemoryBudget()
+        */
+        virtual bool evict();
+
+        //! Checks if the texture has been evicted.
+        inline bool isEvicted() const { return evicted; }
+
+        //! Restore.
+        /*!
+            Reloads an evicted texture from its source. bind() does this automatically.
+            \return False if the image could not be loaded.
+        */
+        bool restore();
+
+        //! Lock.
+        /*!
+            Locks the texture. Before getPixel() or setPixel() can be called, this must be called first.
+            \return True if it was able to lock the texture.
+            \sa unlock(), setPixel(), getPixel()
+        */
+        bool lock();
+
+        //! Unlock.
+        /*!
+            Unlocks the texture. It transfers all the texture data back into video memory. This must be called
+            after the user is done modifying the texture with setPixel().
+            \note Modified textures no longer match their source, so they are never evicted.
+            \sa lock(), setPixel(), getPixel()
+        */
+        void unlock();
+
+		//! Unlock (BGRA Version)
+		/*!
+			Uploads the texture to video memory assuming a BGRA format.
+			\note Advanced
+			\sa unlock()
+		*/
+		void unlock(bool BGRA);
+
+		//! Asynchronous readback.
+		/*!
+			Starts copying the texture's data into client memory without stalling the pipeline like lock() does.
+			The returned handle can be mapped a frame or two later once the transfer has completed.
+			\sa TextureReadback, lock()
+		*/
+		boost::intrusive_ptr<TextureReadback> readback();
+
+        //! Changes a pixel to the given color. lock() must be called before this is possible.
+        void setPixel( const Vector2d& _p, const Color& _c);
+
+        //! Gets the color of the given pixel. lock() must be called before this is possible.
+        const Color getPixel( const Vector2d& _p ) const;
+
+        //! Binds this texture as the current OpenGL texture use for drawing.
+        /*!
+            Reloads the texture if it was evicted.
+        */
+        inline bool bind()
+		{
+			if( evicted ) restore();
+			touch();
+			if (texture) //make sure this is a texture (without asking OpenGL, which has to wait for it)
+			{
+				GLState::bindTexture(texture); //set the texture, if it isn't already
+				return true;
+			}
+			return false;
+		}
+
+        //! Makes a hard (separate) copy of the texture.
+		boost::intrusive_ptr<Texture> copy();
+
+	protected:
+
+        //! Pointer to the OpenGL Texture.
+        GLuint texture;
+
+        //! Width of the texture.
+        int width;
+
+        //! Height of the texture.
+        int height;
+
+        //! Data used during texture manipulation.
+        /*!
+            \sa lock(),unlock(),setPixel(),getPixel()
+        */
+        GLubyte* data;
+
+        //! OpenGL internal format.
+        GLenum internal_format;
+
+        //! Compressed storage.
+        bool compressed;
+
+        //! Bytes of video memory, 0 if not known.
+        boost::uint64_t memory_usage;
+
+        //! File the texture was loaded from.
+        std::string source;
+
+        //! SOIL flags used to load the source.
+        unsigned int source_flags;
+
+        //! Evicted from video memory.
+        bool evicted;
+
+        //! Every pixel has an alpha of 255.
+        bool opaque;
+
+    };
+
+    //! Friendly name for texture pointers
+    typedef boost::intrusive_ptr<Texture> TexturePtr;
+
+}//namespace phoenix
+
+#endif //__PHOENIXTEX_H__
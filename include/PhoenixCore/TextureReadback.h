@@ -0,0 +1,111 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHTEXTUREREADBACK_H__
+#define __PHTEXTUREREADBACK_H__
+
+#include <boost/noncopyable.hpp>
+#include "config.h"
+#include "Color.h"
+#include "Vector2d.h"
+#include "Texture.h"
+
+namespace phoenix
+{
+
+	//! Asynchronous texture readback.
+	/*!
+		Handle to a pending transfer of a texture's pixels into client memory. Created by
+		Texture::readback(), which queues a copy into a pixel buffer object and places a
+		fence behind it, so the call returns without waiting for the GPU. One or two frames
+		later the data can be checked with ready() and accessed with map() without stalling
+		the pipeline. If pixel buffer objects or sync objects are not available the copy is
+		done synchronously and the readback is ready immediately.
+		\note The data is in RGBA format, with the same layout as Texture::lock().
+		\sa Texture::readback(), Texture::lock()
+	*/
+	class TextureReadback
+		: public Droppable, boost::noncopyable
+	{
+
+	public:
+
+		//! Constructor
+		/*!
+			Starts the transfer of the given texture. Should not be called directly, use Texture::readback().
+		*/
+		TextureReadback( Texture& _t );
+
+		//! Destructor
+		/*!
+			Deletes the pixel buffer and the fence.
+		*/
+		virtual ~TextureReadback();
+
+		//! Checks if the transfer has finished without blocking.
+		bool ready();
+
+		//! Blocks until the transfer has finished.
+		void wait();
+
+		//! Map
+		/*!
+			Maps the transferred data into client memory. This will block if the transfer has
+			not finished yet, so check ready() first to avoid stalling.
+			\return A pointer to width*height*4 bytes of RGBA data, or NULL if it failed.
+			\sa unmap(), ready()
+		*/
+		const GLubyte* map();
+
+		//! Unmaps the data. Must be called once you're done with the pointer returned by map().
+		void unmap();
+
+		//! Gets the color of the given pixel. map() must be called before this is possible.
+		const Color getPixel( const Vector2d& _p ) const;
+
+		//! Get the width of the captured data.
+		inline int getWidth() const { return width; }
+
+		//! Get the height of the captured data.
+		inline int getHeight() const { return height; }
+
+		//! Get the size of the captured data.
+		inline const Vector2d getSize() const { return Vector2d( (float) width, (float) height ); }
+
+		//! Checks if pixel buffer objects and sync objects are available.
+		static bool isAsyncSupported();
+
+	protected:
+
+		//! Pixel buffer object, 0 if using the synchronous fallback.
+		GLuint pbo;
+
+		//! Fence placed after the transfer.
+		GLsync fence;
+
+		//! Width of the data.
+		int width;
+
+		//! Height of the data.
+		int height;
+
+		//! Currently mapped data.
+		GLubyte* data;
+
+		//! Client side copy used by the synchronous fallback.
+		GLubyte* fallback;
+
+	};
+
+	//! Friendly name for readback pointers.
+	typedef boost::intrusive_ptr<TextureReadback> TextureReadbackPtr;
+
+} //namespace phoenix
+
+#endif //__PHTEXTUREREADBACK_H__
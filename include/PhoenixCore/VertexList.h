@@ -0,0 +1,172 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHVERTEXLIST_H__
+#define __PHVERTEXLIST_H__
+
+#include <new>
+#include <cstddef>
+#include "config.h"
+#include "Vertex.h"
+
+namespace phoenix
+{
+
+//! Vertex List
+/*!
+	A list of vertices that keeps the first few inside itself and only goes to the heap
+	for bigger meshes. Nearly all geometry is lines, quads, or a couple of triangles, so
+	this saves BatchGeometry an allocation (or several, while it grows) for each piece.
+	It works like a cut down std::vector, and like std::vector, clear() keeps the storage
+	around for reuse.
+*/
+class VertexList
+{
+
+public:
+
+	typedef Vertex value_type;
+	typedef Vertex& reference;
+	typedef const Vertex& const_reference;
+	typedef Vertex* iterator;
+	typedef const Vertex* const_iterator;
+	typedef std::size_t size_type;
+	typedef std::ptrdiff_t difference_type;
+
+	//! The number of vertices kept inside the list itself.
+	static const unsigned int INLINE_CAPACITY = 6;
+
+	VertexList()
+		: vertices( local() ), count(0), capacity( INLINE_CAPACITY )
+	{
+	}
+
+	VertexList( const VertexList& other )
+		: vertices( local() ), count(0), capacity( INLINE_CAPACITY )
+	{
+		reserve( other.count );
+		for( unsigned int i = 0; i < other.count; ++i )
+			new( vertices + i ) Vertex( other.vertices[i] );
+		count = other.count;
+	}
+
+	~VertexList()
+	{
+		clear();
+		if( ! isInline() ) ::operator delete( vertices );
+	}
+
+	VertexList& operator= ( const VertexList& other )
+	{
+		if( this != &other )
+		{
+			clear();
+			reserve( other.count );
+			for( unsigned int i = 0; i < other.count; ++i )
+				new( vertices + i ) Vertex( other.vertices[i] );
+			count = other.count;
+		}
+		return *this;
+	}
+
+	inline iterator begin() { return vertices; }
+	inline iterator end() { return vertices + count; }
+	inline const_iterator begin() const { return vertices; }
+	inline const_iterator end() const { return vertices + count; }
+
+	inline Vertex& operator[] ( unsigned int _i ) { return vertices[_i]; }
+	inline const Vertex& operator[] ( unsigned int _i ) const { return vertices[_i]; }
+
+	inline Vertex& back() { return vertices[count-1]; }
+
+	inline unsigned int size() const { return count; }
+	inline bool empty() const { return count == 0; }
+
+	//! Gets how many vertices fit before the list has to grow.
+	inline unsigned int getCapacity() const { return capacity; }
+
+	//! Checks if the vertices are still stored inside the list.
+	inline bool isInline() const { return vertices == local(); }
+
+	inline void push_back( const Vertex& _v )
+	{
+		if( count == capacity ) grow( count + 1 );
+		new( vertices + count ) Vertex( _v );
+		++count;
+	}
+
+	inline void pop_back()
+	{
+		--count;
+		vertices[count].~Vertex();
+	}
+
+	//! Removes every vertex, keeping the storage.
+	inline void clear()
+	{
+		for( unsigned int i = 0; i < count; ++i )
+			vertices[i].~Vertex();
+		count = 0;
+	}
+
+	//! Makes sure there's room for _n vertices.
+	inline void reserve( unsigned int _n )
+	{
+		if( _n > capacity ) grow( _n );
+	}
+
+	//! Removes one vertex, moving the ones after it down.
+	iterator erase( iterator _it )
+	{
+		for( iterator v = _it; v + 1 != end(); ++v )
+			*v = *(v + 1);
+		pop_back();
+		return _it;
+	}
+
+private:
+
+	inline Vertex* local() { return reinterpret_cast< Vertex* >( storage.bytes ); }
+	inline const Vertex* local() const { return reinterpret_cast< const Vertex* >( storage.bytes ); }
+
+	//! Moves everything to the heap with room for at least _n vertices.
+	void grow( unsigned int _n )
+	{
+		unsigned int newcapacity = capacity * 2;
+		if( newcapacity < _n ) newcapacity = _n;
+
+		Vertex* newvertices = static_cast< Vertex* >( ::operator new( newcapacity * sizeof( Vertex ) ) );
+		for( unsigned int i = 0; i < count; ++i )
+		{
+			new( newvertices + i ) Vertex( vertices[i] );
+			vertices[i].~Vertex();
+		}
+
+		if( ! isInline() ) ::operator delete( vertices );
+		vertices = newvertices;
+		capacity = newcapacity;
+	}
+
+	//! Either the inline storage or the heap.
+	Vertex* vertices;
+
+	unsigned int count;
+	unsigned int capacity;
+
+	//! Inline storage, the float keeps it aligned for Vertex.
+	union
+	{
+		float align;
+		char bytes[ INLINE_CAPACITY * sizeof( Vertex ) ];
+	} storage;
+};
+
+} //namespace phoenix
+
+#endif // __PHVERTEXLIST_H__
@@ -0,0 +1,105 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHVERTEXTRANSFORM_H__
+#define __PHVERTEXTRANSFORM_H__
+
+#include "config.h"
+#include "Vertex.h"
+#include "RotationMatrix.h"
+
+namespace phoenix
+{
+
+//! 2D Affine Transform
+/*!
+	A 2x3 matrix, so \f$ x' = a x + b y + t_x \f$ and \f$ y' = c x + d y + t_y \f$. Any run of
+	scales, rotations, and translations folds into one of these.
+	\sa transformVertices(), BatchGeometry::setTransform()
+*/
+class AffineTransform
+{
+
+public:
+
+	//! Identity.
+	AffineTransform()
+		: a(1), b(0), c(0), d(1), tx(0), ty(0)
+	{}
+
+	//! Scale, then rotate, then translate.
+	AffineTransform( const Vector2d& _s, const RotationMatrix& _m, const Vector2d& _t )
+		: a( _m.getElement(0) * _s.getX() ), b( _m.getElement(1) * _s.getY() ),
+		c( _m.getElement(2) * _s.getX() ), d( _m.getElement(3) * _s.getY() ),
+		tx( _t.getX() ), ty( _t.getY() )
+	{}
+
+	//! Scale and rotate about _origin, then move _origin to _position.
+	static AffineTransform fromParts( const Vector2d& _position, const RotationMatrix& _rotation, const Vector2d& _scale, const Vector2d& _origin )
+	{
+		AffineTransform r( _scale, _rotation, _position );
+		r.tx -= r.a * _origin.getX() + r.b * _origin.getY();
+		r.ty -= r.c * _origin.getX() + r.d * _origin.getY();
+		return r;
+	}
+
+	//! Composition, the result applies rhs first and then this.
+	inline const AffineTransform operator* ( const AffineTransform& rhs ) const
+	{
+		AffineTransform r;
+		r.a = a * rhs.a + b * rhs.c;
+		r.b = a * rhs.b + b * rhs.d;
+		r.c = c * rhs.a + d * rhs.c;
+		r.d = c * rhs.b + d * rhs.d;
+		r.tx = a * rhs.tx + b * rhs.ty + tx;
+		r.ty = c * rhs.tx + d * rhs.ty + ty;
+		return r;
+	}
+
+	//! Transforms a single point.
+	inline const Vector2d apply( const Vector2d& _v ) const
+	{
+		return Vector2d( a * _v.getX() + b * _v.getY() + tx, c * _v.getX() + d * _v.getY() + ty, _v.getZ() );
+	}
+
+	float a, b, c, d, tx, ty;
+};
+
+/*!
+	Vertex transform kernels. These work on a run of vertices in place and are what BatchGeometry's
+	translate(), scale(), rotate(), transform(), and colorize() use. When PH_USE_SSE2 is set, positions are
+	done two vertices at a time with SSE2, otherwise with plain loops that don't go through Vector2d's operators.
+	Only x and y are changed, z is left alone.
+*/
+
+//! Adds _t to each position.
+void translateVertices( Vertex* _v, unsigned int _n, const Vector2d& _t );
+
+//! Multiplies each position by _s component-wise.
+void scaleVertices( Vertex* _v, unsigned int _n, const Vector2d& _s );
+
+//! Rotates each position by _m (the same as Vector2d::operator*=( const RotationMatrix& )).
+void rotateVertices( Vertex* _v, unsigned int _n, const RotationMatrix& _m );
+
+//! Scales, rotates, and then translates each position in one pass.
+/*!
+	The same as scaleVertices(), rotateVertices(), and translateVertices() in that order, but the three
+	are folded into one 2x3 matrix first, so each vertex is only read and written once.
+*/
+void transformVertices( Vertex* _v, unsigned int _n, const Vector2d& _s, const RotationMatrix& _m, const Vector2d& _t );
+
+//! Applies an affine transform to each position.
+void transformVertices( Vertex* _v, unsigned int _n, const AffineTransform& _a );
+
+//! Sets the color of each vertex.
+void colorizeVertices( Vertex* _v, unsigned int _n, const Color& _c );
+
+} //namespace phoenix
+
+#endif // __PHVERTEXTRANSFORM_H__
@@ -1,29 +1,43 @@
-/*!
-	PhoenixCore Config File.
-*/
-#ifndef __PHOENIXCORE_CONFIG_H__
-#define __PHOENIXCORE_CONFIG_H__
-
-// Version Name/Number/Release.
-#define PHOENIXCORE_VERSION "PhoenixCore 0.3 Raven"
-#define PHEONIXCORE_VERSION_NUMBER "0.3"
-#define PHEONIXCORE_VERSION_NAME "Raven"
-
-// OpenGL Include
-#include "GL/glew.h"
-#include <GL/glfw.h>
-
-//! Define this to use the default GLFW Window Manager, or set to 0 to not compile the GLFW window manager.
-/*!
-	\note If this is 0, the system will not have a window manager, your custom window manager must be Instance()'d before calling RenderSystem(); 
-*/
-#define PH_USE_GLFW 1
-
-#if defined(__GNUC__) && (defined(__linux__) || defined(__linux) || defined(WIN32) || defined(__WIN32__) || defined(__WIN32))
-// Define this to ensure correct linkage with boost threads in MinGW 4.7+.
-#ifndef BOOST_THREAD_USE_LIB
-#define BOOST_THREAD_USE_LIB 1
-#endif
-#endif
-
-#endif //__PHOENIXCORE_CONFIG_H__
+/*!
+	PhoenixCore Config File.
+*/
+#ifndef __PHOENIXCORE_CONFIG_H__
+#define __PHOENIXCORE_CONFIG_H__
+
+// Version Name/Number/Release.
+#define PHOENIXCORE_VERSION "PhoenixCore 0.3 Raven"
+#define PHEONIXCORE_VERSION_NUMBER "0.3"
+#define PHEONIXCORE_VERSION_NAME "Raven"
+
+// OpenGL Include
+#include "GL/glew.h"
+#include <GL/glfw.h>
+
+//! Define this to use the default GLFW Window Manager, or set to 0 to not compile the GLFW window manager.
+/*!
+	\note If this is 0, the system will not have a window manager, your custom window manager must be Instance()'d before calling RenderSystem(); 
+*/
+#define PH_USE_GLFW 1
+
+//! Set to 1 when the compiler targets SSE2, used by the vertex transform kernels. Define it as 0 to use plain loops.
+#ifndef PH_USE_SSE2
+#if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#define PH_USE_SSE2 1
+#else
+#define PH_USE_SSE2 0
+#endif
+#endif
+
+//! Set to 1 to make Droppable's reference count atomic, so intrusive pointers to geometry and resources can be copied and released on any thread. Define it as 0 if everything is made and dropped on one thread.
+#ifndef PH_ATOMIC_REFCOUNT
+#define PH_ATOMIC_REFCOUNT 1
+#endif
+
+#if defined(__GNUC__) && (defined(__linux__) || defined(__linux) || defined(WIN32) || defined(__WIN32__) || defined(__WIN32))
+// Define this to ensure correct linkage with boost threads in MinGW 4.7+.
+#ifndef BOOST_THREAD_USE_LIB
+#define BOOST_THREAD_USE_LIB 1
+#endif
+#endif
+
+#endif //__PHOENIXCORE_CONFIG_H__
@@ -0,0 +1,173 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include "AssetPack.h"
+
+#include <cstring>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace phoenix;
+
+AssetPack::AssetPack()
+	: filename(), data(NULL), size(0), header(NULL), entries(NULL)
+#ifdef WIN32
+	, file(NULL), mapping(NULL)
+#endif
+{
+}
+
+AssetPack::AssetPack( const std::string& _fn )
+	: filename(), data(NULL), size(0), header(NULL), entries(NULL)
+#ifdef WIN32
+	, file(NULL), mapping(NULL)
+#endif
+{
+	open( _fn );
+}
+
+AssetPack::~AssetPack()
+{
+	close();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Mapping
+////////////////////////////////////////////////////////////////////////////////
+
+bool AssetPack::open( const std::string& _fn )
+{
+	close();
+
+#ifdef WIN32
+	file = CreateFileA( _fn.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+	if( file == INVALID_HANDLE_VALUE ){ file = NULL; return false; }
+
+	size = (size_t) GetFileSize( (HANDLE) file, NULL );
+	mapping = CreateFileMappingA( (HANDLE) file, NULL, PAGE_READONLY, 0, 0, NULL );
+	if( mapping != NULL ) data = (const unsigned char*) MapViewOfFile( (HANDLE) mapping, FILE_MAP_READ, 0, 0, 0 );
+#else
+	int fd = ::open( _fn.c_str(), O_RDONLY );
+	if( fd < 0 ) return false;
+
+	struct stat st;
+	if( fstat( fd, &st ) == 0 && st.st_size > 0 )
+	{
+		size = (size_t) st.st_size;
+		void* m = mmap( NULL, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+		if( m != MAP_FAILED ) data = (const unsigned char*) m;
+	}
+
+	// The mapping stays valid after the descriptor is closed.
+	::close( fd );
+#endif
+
+	if( data == NULL )
+	{
+		close();
+		return false;
+	}
+
+	// Check the header and make sure the table fits.
+	header = (const Header*) data;
+	if( size < sizeof(Header)
+		|| std::memcmp( header->magic, "PHXPACK", 8 ) != 0
+		|| header->version != VERSION
+		|| header->slots == 0 || ( header->slots & (header->slots-1) ) != 0
+		|| header->count > header->slots
+		|| (size - sizeof(Header)) / sizeof(Entry) < header->slots )
+	{
+		close();
+		return false;
+	}
+
+	entries = (const Entry*)( data + sizeof(Header) );
+	filename = _fn;
+	return true;
+}
+
+void AssetPack::close()
+{
+#ifdef WIN32
+	if( data != NULL ) UnmapViewOfFile( data );
+	if( mapping != NULL ) CloseHandle( (HANDLE) mapping );
+	if( file != NULL ) CloseHandle( (HANDLE) file );
+	mapping = file = NULL;
+#else
+	if( data != NULL ) munmap( (void*) data, size );
+#endif
+
+	data = NULL;
+	size = 0;
+	header = NULL;
+	entries = NULL;
+	filename.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Lookup
+////////////////////////////////////////////////////////////////////////////////
+
+bool AssetPack::find( const std::string& _name, const unsigned char*& _data, unsigned int& _size ) const
+{
+	if( !header ) return false;
+
+	const std::string name = normalize( _name );
+	const unsigned int h = hash( name.c_str(), name.size() );
+	const unsigned int mask = header->slots - 1;
+
+	for( unsigned int i = 0, slot = h & mask; i < header->slots; ++i, slot = (slot+1) & mask )
+	{
+		const Entry& e = entries[slot];
+
+		// Empty slot, it's not here.
+		if( e.offset == 0 ) return false;
+
+		if( e.hash == h && e.name_length == name.size()
+			&& e.name_offset <= size && name.size() <= size - e.name_offset
+			&& std::memcmp( data + e.name_offset, name.c_str(), name.size() ) == 0 )
+		{
+			if( e.offset > size || e.size > size - e.offset ) return false;
+			_data = data + e.offset;
+			_size = e.size;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+unsigned int AssetPack::hash( const char* _s, unsigned int _len )
+{
+	unsigned int h = 2166136261u;
+	for( unsigned int i = 0; i < _len; ++i )
+	{
+		h ^= (unsigned char) _s[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+std::string AssetPack::normalize( const std::string& _name )
+{
+	std::string name = _name;
+	for( size_t i = 0; i < name.size(); ++i )
+	{
+		if( name[i] == '\\' ) name[i] = '/';
+	}
+	while( name.compare( 0, 2, "./" ) == 0 ) name.erase( 0, 2 );
+	return name;
+}
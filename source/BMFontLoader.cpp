@@ -1,176 +1,286 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-#include "BMFontLoader.h"
-
-using namespace phoenix;
-using namespace std;
-using namespace boost;
-
-/* Loads a FNT file */
-void BMFontLoader::load( const std::string& fnt_file ){
-	//find the directory (For loading pages)
-	std::string directory = fnt_file;
-	for( size_t n = 0; (n = directory.find('/', n)) != string::npos; ) directory.replace(n, 1, "\\");
-	size_t i = directory.rfind('\\');
-	if( i != string::npos ){
-		directory = directory.substr(0, i+1);
-	} else {
-		directory = "";
-	}
-
-	// read all of the contents
-	std::ifstream in(fnt_file.c_str());
-	if( !in ) return;
-
-	std::stringstream buffer;
-	buffer << in.rdbuf();
-
-	std::string contents(buffer.str());
-
-	//load it
-	loadFromString( contents, directory );
-
-}
-
-/*
-Parse a FNT file from a string
-*/
-void BMFontLoader::loadFromString( const std::string& _data, const std::string& _directory ){
-	stringstream stream(_data);
-	string line;
-	string directory = _directory;
-
-	/* Parse! */
-	while( stream.good() ){
-		getline( stream, line );
-		
-		//tokenize, parse.
-		typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
-		boost::char_separator<char> sep(" =");
-		tokenizer tokens(line, sep);
-
-		for (tokenizer::iterator it = tokens.begin(); it != tokens.end(); ++it) {
-			string token = *it;
-
-
-			/* Common Properties */
-			if( token == "common" ){
-
-				//parse the info.
-				for (++it; it != tokens.end(); ++it) {
-					string name = *it; 
-					if( name == "lineHeight" ){
-						font->setLineHeight( (float)atoi( (*++it).c_str() ) );
-					}
-				}
-
-				break;
-			}
-
-			/* Load Page Texture */
-			if( token == "page" ){
-				unsigned int id = 0;
-				TexturePtr t;
-
-				//parse the info.
-				for (++it; it != tokens.end(); ++it) {
-					string name = *it; 
-					if( name == "file" ) {
-						std::string filename;
-
-						// gather the filename until we reach the end
-						for( ++it; it != tokens.end(); ++it ){
-							filename += std::string(" ") + *(it); 
-						}
-						
-						boost::trim_if(filename, boost::is_any_of(" \""));
-						t = system.loadTexture(directory + filename);
-						break;
-					}
-					else if( name == "id" ){
-						id = (unsigned int)atoi( (*++it).c_str() );
-						break;
-					}
-				}
-
-				font->setPage( id, t );
-				font->setTexture( t );
-
-				break;
-			}
-
-			/* Load character data */
-			if( token == "char" ){
-				int id = 0;
-				BitmapFont::Character c;
-
-				for (++it; it != tokens.end(); ++it) {
-					string name = *it; 
-					if( name == "id" ){
-						id = atoi( (*++it).c_str() );
-					}
-					else if( name == "x" ){
-						c.x = atoi( (*++it).c_str() );
-					}
-					else if( name == "y" ){
-						c.y = atoi( (*++it).c_str() );
-					}
-					else if( name == "width" ){
-						c.width = atoi( (*++it).c_str() );
-					}
-					else if( name == "height" ){
-						c.height = atoi( (*++it).c_str() );
-					}
-					else if( name == "xoffset" ){
-						c.xoffset = atoi( (*++it).c_str() );
-					}
-					else if( name == "yoffset" ){
-						c.yoffset = atoi( (*++it).c_str() );
-					}
-					else if( name == "xadvance" ){
-						c.xadvance = atoi( (*++it).c_str() );
-					}
-					else if( name == "page" ){
-						c.page = (unsigned int)atoi( (*++it).c_str() );
-					}
-				}
-				
-				if( id != 0 ){
-					font->setCharacterProperties(id,c);
-				}
-				
-				break;
-			}
-
-			/* Load Kerning Pairs */
-			if( token == "kerning" ){
-				int first = 0;
-				int second = 0;
-				int amount = 0;
-
-				for (++it; it != tokens.end(); ++it) {
-					string name = *it; 
-					if( name == "first" ){
-						first = atoi( (*++it).c_str() );
-					}
-					if( name == "second" ){
-						second = atoi( (*++it).c_str() );
-					}
-					if( name == "amount" ){
-						amount = atoi( (*++it).c_str() );
-					}
-				}
-
-				font->setKerning( first, second, amount );
-				break;
-			}
-		}
-	}
-}
\ No newline at end of file
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <algorithm>
+#include <cstring>
+#include "BMFontLoader.h"
+
+using namespace phoenix;
+using namespace std;
+using namespace boost;
+
+/* Loads a FNT file */
+void BMFontLoader::load( const std::string& fnt_file ){
+	//find the directory (For loading pages)
+	std::string directory = fnt_file;
+	for( size_t n = 0; (n = directory.find('/', n)) != string::npos; ) directory.replace(n, 1, "\\");
+	size_t i = directory.rfind('\\');
+	if( i != string::npos ){
+		directory = directory.substr(0, i+1);
+	} else {
+		directory = "";
+	}
+
+	// read all of the contents in one go, binary fonts need the exact bytes.
+	std::ifstream in(fnt_file.c_str(), std::ios::in | std::ios::binary);
+	if( !in ) return;
+
+	in.seekg( 0, std::ios::end );
+	std::vector<char> contents( (size_t) in.tellg() );
+	in.seekg( 0, std::ios::beg );
+	if( contents.empty() || !in.read( &contents[0], contents.size() ) ) return;
+
+	//load it
+	pack = NULL;
+	loadFromMemory( &contents[0], &contents[0] + contents.size(), directory );
+
+}
+
+/* Loads a FNT file from an asset pack */
+void BMFontLoader::load( const AssetPack& _pack, const std::string& fnt_file ){
+	const unsigned char* data;
+	unsigned int size;
+	if( !_pack.find( fnt_file, data, size ) ) return;
+
+	//pages are relative to the font, inside the pack.
+	std::string directory = AssetPack::normalize( fnt_file );
+	size_t i = directory.rfind('/');
+	directory = ( i != string::npos ) ? directory.substr(0, i+1) : "";
+
+	pack = &_pack;
+	loadFromMemory( (const char*) data, (const char*) data + size, directory );
+	pack = NULL;
+}
+
+/*
+Parse a FNT file from a string
+*/
+void BMFontLoader::loadFromString( const std::string& _data, const std::string& _directory ){
+	loadFromMemory( _data.data(), _data.data() + _data.size(), _directory );
+}
+
+/*
+Parse a FNT file from a range of characters, text or binary.
+*/
+void BMFontLoader::loadFromMemory( const char* _begin, const char* _end, const std::string& _directory ){
+	if( _end - _begin >= 4 && std::memcmp( _begin, "BMF", 3 ) == 0 ){
+		loadBinary( (const unsigned char*) _begin, (const unsigned char*) _end, _directory );
+	} else {
+		loadText( _begin, _end, _directory );
+	}
+
+	font->buildKerning();
+}
+
+/*
+Loads a page texture, from the pack if there is one.
+*/
+void BMFontLoader::loadPage( unsigned int _id, const std::string& _file ){
+	TexturePtr t;
+	if( pack )
+		t = system.loadTexture(*pack, _file);
+	else
+		t = system.loadTexture(_file);
+
+	font->setPage( _id, t );
+	font->setTexture( t );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Text format
+////////////////////////////////////////////////////////////////////////////////
+
+/* Skips spaces and tabs (but not newlines) */
+static inline const char* skipBlanks( const char* p, const char* end ){
+	while( p < end && ( *p == ' ' || *p == '\t' || *p == '\r' ) ) ++p;
+	return p;
+}
+
+/* Checks if [p,end) is the given keyword */
+static inline bool keyIs( const char* p, const char* end, const char* key, size_t len ){
+	return (size_t)(end - p) == len && std::memcmp( p, key, len ) == 0;
+}
+#define KEY_IS( p, end, key ) keyIs( p, end, key, sizeof(key)-1 )
+
+/* Parses a (possibly negative) integer in place */
+static inline int parseInt( const char* p, const char* end ){
+	bool negative = false;
+	if( p < end && ( *p == '-' || *p == '+' ) ) negative = ( *p++ == '-' );
+	int value = 0;
+	for( ; p < end && *p >= '0' && *p <= '9'; ++p ) value = value*10 + (*p - '0');
+	return negative ? -value : value;
+}
+
+/*
+Single pass over the text, nothing is copied except page filenames.
+Each line is a tag followed by key=value pairs, values are either
+numbers, comma separated lists or quoted strings.
+*/
+void BMFontLoader::loadText( const char* _begin, const char* _end, const std::string& _directory ){
+	const char* p = _begin;
+
+	while( p < _end ){
+		// Tag
+		p = skipBlanks( p, _end );
+		const char* tag = p;
+		while( p < _end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' ) ++p;
+		const char* tag_end = p;
+
+		enum { T_OTHER, T_COMMON, T_PAGE, T_CHAR, T_KERNING } type = T_OTHER;
+		if( KEY_IS( tag, tag_end, "char" ) ) type = T_CHAR;
+		else if( KEY_IS( tag, tag_end, "kerning" ) ) type = T_KERNING;
+		else if( KEY_IS( tag, tag_end, "common" ) ) type = T_COMMON;
+		else if( KEY_IS( tag, tag_end, "page" ) ) type = T_PAGE;
+
+		int id = 0, first = 0, second = 0, amount = 0;
+		BitmapFont::Character c = BitmapFont::Character();
+		const char* file = NULL, * file_end = NULL;
+
+		// Pairs
+		while( true ){
+			p = skipBlanks( p, _end );
+			if( p >= _end || *p == '\n' ) break;
+
+			const char* key = p;
+			while( p < _end && *p != '=' && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' ) ++p;
+			const char* key_end = p;
+			if( p >= _end || *p != '=' ) continue;
+			++p;
+
+			const char* value = p, * value_end;
+			if( p < _end && *p == '"' ){
+				value = ++p;
+				while( p < _end && *p != '"' && *p != '\n' ) ++p;
+				value_end = p;
+				if( p < _end && *p == '"' ) ++p;
+			} else {
+				while( p < _end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' ) ++p;
+				value_end = p;
+			}
+
+			switch( type ){
+			case T_CHAR:
+				if( KEY_IS( key, key_end, "id" ) ) id = parseInt( value, value_end );
+				else if( KEY_IS( key, key_end, "x" ) ) c.x = parseInt( value, value_end );
+				else if( KEY_IS( key, key_end, "y" ) ) c.y = parseInt( value, value_end );
+				else if( KEY_IS( key, key_end, "width" ) ) c.width = parseInt( value, value_end );
+				else if( KEY_IS( key, key_end, "height" ) ) c.height = parseInt( value, value_end );
+				else if( KEY_IS( key, key_end, "xoffset" ) ) c.xoffset = parseInt( value, value_end );
+				else if( KEY_IS( key, key_end, "yoffset" ) ) c.yoffset = parseInt( value, value_end );
+				else if( KEY_IS( key, key_end, "xadvance" ) ) c.xadvance = parseInt( value, value_end );
+				else if( KEY_IS( key, key_end, "page" ) ) c.page = (unsigned int) parseInt( value, value_end );
+				break;
+			case T_KERNING:
+				if( KEY_IS( key, key_end, "first" ) ) first = parseInt( value, value_end );
+				else if( KEY_IS( key, key_end, "second" ) ) second = parseInt( value, value_end );
+				else if( KEY_IS( key, key_end, "amount" ) ) amount = parseInt( value, value_end );
+				break;
+			case T_COMMON:
+				if( KEY_IS( key, key_end, "lineHeight" ) ) font->setLineHeight( (float) parseInt( value, value_end ) );
+				break;
+			case T_PAGE:
+				if( KEY_IS( key, key_end, "id" ) ) id = parseInt( value, value_end );
+				else if( KEY_IS( key, key_end, "file" ) ){ file = value; file_end = value_end; }
+				break;
+			default:
+				break;
+			}
+		}
+
+		switch( type ){
+		case T_CHAR:
+			// -1 is the glyph for missing characters, which the font keeps in 0.
+			if( id != 0 ) font->setCharacterProperties( id == -1 ? 0 : id, c );
+			break;
+		case T_KERNING:
+			font->setKerning( first, second, amount );
+			break;
+		case T_PAGE:
+			if( file ) loadPage( (unsigned int) id, _directory + std::string( file, file_end ) );
+			break;
+		default:
+			break;
+		}
+
+		// Next line
+		if( p < _end ) ++p;
+	}
+}
+
+#undef KEY_IS
+
+////////////////////////////////////////////////////////////////////////////////
+// Binary format
+////////////////////////////////////////////////////////////////////////////////
+
+/* Little endian readers */
+static inline unsigned int readU32( const unsigned char* p ){ return p[0] | (p[1]<<8) | (p[2]<<16) | ((unsigned int)p[3]<<24); }
+static inline unsigned int readU16( const unsigned char* p ){ return p[0] | (p[1]<<8); }
+static inline int readS16( const unsigned char* p ){ return (int)(short)( p[0] | (p[1]<<8) ); }
+
+/*
+AngelCode binary format (version 3). After the "BMF" + version header
+comes a series of blocks, each a one byte type and a 32-bit size:
+	1 info, 2 common, 3 page names, 4 chars (20 bytes each), 5 kerning pairs (10 bytes each).
+*/
+void BMFontLoader::loadBinary( const unsigned char* _begin, const unsigned char* _end, const std::string& _directory ){
+	if( _begin[3] != 3 ) return;
+
+	const unsigned char* p = _begin + 4;
+
+	while( _end - p >= 5 ){
+		const unsigned char type = p[0];
+		const unsigned int size = readU32( p + 1 );
+		p += 5;
+		if( (unsigned int)(_end - p) < size ) return;
+		const unsigned char* block = p, * block_end = p + size;
+
+		switch( type ){
+		case 2: // common
+			if( size >= 2 ) font->setLineHeight( (float) readU16( block ) );
+			break;
+
+		case 3: // page names, null terminated and all the same length
+			for( unsigned int id = 0; block < block_end; ++id ){
+				const unsigned char* name_end = std::find( block, block_end, (unsigned char) 0 );
+				if( name_end == block ) break;
+				loadPage( id, _directory + std::string( (const char*) block, (const char*) name_end ) );
+				block = name_end + 1;
+			}
+			break;
+
+		case 4: // chars
+			for( ; block_end - block >= 20; block += 20 ){
+				const unsigned int id = readU32( block );
+				BitmapFont::Character c;
+				c.x = (int) readU16( block + 4 );
+				c.y = (int) readU16( block + 6 );
+				c.width = (int) readU16( block + 8 );
+				c.height = (int) readU16( block + 10 );
+				c.xoffset = readS16( block + 12 );
+				c.yoffset = readS16( block + 14 );
+				c.xadvance = readS16( block + 16 );
+				c.page = block[18];
+				if( id != 0 ) font->setCharacterProperties( id == 0xffffffff ? 0 : (int) id, c );
+			}
+			break;
+
+		case 5: // kerning pairs
+			for( ; block_end - block >= 10; block += 10 ){
+				font->setKerning( (int) readU32( block ), (int) readU32( block + 4 ), readS16( block + 8 ) );
+			}
+			break;
+
+		default: // info and anything unknown is skipped
+			break;
+		}
+
+		p = block_end;
+	}
+}
@@ -1,446 +1,919 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-//Uncomment this for really annoying spam on msvc compilers.
-//#pragma warning( disable : 4503 )
-#include "BatchRenderer.h"
-
-using namespace boost;
-using namespace phoenix;
-using namespace std;
-
-#ifdef DEBUG_BATCHRENDERER
-//! Lists all the geometry in the list.
-void BatchRenderer::listGeometry()
-{
-	BOOST_FOREACH( BATCHMAPDELTA::value_type& deltapair, geometry ){
-		BOOST_FOREACH( BATCHMAPGAMMA::value_type& gammapair, deltapair.second ){
-			BOOST_FOREACH( BATCHMAPBETA::value_type& betapair, gammapair.second ){
-				BOOST_FOREACH( BATCHMAPALPHA::value_type& alphapair, betapair.second ){
-					BOOST_FOREACH( intrusive_ptr<BatchGeometry>& geom, alphapair.second )
-					{
-						std::cout<<"\n Geometry "<<geom.get()
-							<<" at "
-							<<deltapair.first
-							<<", "<<gammapair.first
-							<<", "<<betapair.first
-							<<", "<<alphapair.first
-							<<" with properties "<<geom->getDepth()
-							<<", "<<geom->getGroup()
-							<<", "<<geom->getTextureId()
-							<<", "<<geom->getPrimitiveType();
-					}
-				}
-			}
-		}
-	}
-}
-#endif
-
-unsigned int BatchRenderer::count()
-{
-	boost::recursive_mutex::scoped_lock l( getMutex() );
-	unsigned int total = 0;
-	BOOST_FOREACH( BATCHMAPDELTA::value_type& deltapair, geometry ){
-		BOOST_FOREACH( BATCHMAPGAMMA::value_type& gammapair, deltapair.second ){
-			BOOST_FOREACH( BATCHMAPBETA::value_type& betapair, gammapair.second ){
-				BOOST_FOREACH( BATCHMAPALPHA::value_type& alphapair, betapair.second ){
-					total += alphapair.second.size();
-				}
-			}
-		}
-	}
-	return total;
-}
-
-
-void BatchRenderer::add( boost::intrusive_ptr<BatchGeometry> _g )
-{
-	boost::recursive_mutex::scoped_lock l( getMutex() );
-	geometry[_g->getDepth()][ _g->getGroup() ][ _g->getTextureId() ][_g->getPrimitiveType()].push_back( _g );
-}
-
-void BatchRenderer::remove( boost::intrusive_ptr<BatchGeometry> _g )
-{
-	boost::recursive_mutex::scoped_lock l( getMutex() );
-	recyclelist.push_back( _g );
-}
-
-void BatchRenderer::removeProper( boost::intrusive_ptr<BatchGeometry> _g, bool _inv )
-{
-
-	unsigned int textureid = _g->getTextureId();
-	signed int groupid = _g->getGroup();
-	unsigned int primitivetype = _g->getPrimitiveType();
-	float depth = _g->getDepth();
-
-	if( _inv == true ) {// we're using the previous value
-		groupid = _g->getGroupInvariant().getPrevious();
-		primitivetype = _g->getPrimitiveTypeInvariant().getPrevious();
-		depth = _g->getDepthInvariant().getPrevious();
-		textureid = _g->getTextureIdInvariant().getPrevious();
-	}
-
-	//lock the mutex
-	boost::recursive_mutex::scoped_lock l( getMutex() );
-
-	GEOMCONTAINER* container = &(geometry[ depth ][ groupid ][ textureid ][ primitivetype ]);
-	GEOMCONTAINER::iterator f = std::find( container->begin(), container->end(), _g );
-	if( f != container->end() )
-	{
-		// The ol' pop & swap; 
-		boost::swap( (*f) , container->back() );
-		container->pop_back();
-
-	}
-	else
-	{
-		//throw;
-	}
-}
-
-void BatchRenderer::move( boost::intrusive_ptr<BatchGeometry> _g )
-{
-	lock();
-	removeProper( _g, true );
-	add( _g );
-	unlock();
-}
-
-
-void BatchRenderer::clean()
-{
-	
-	boost::recursive_mutex::scoped_lock l( getMutex() );
-
-    unsigned int multiplier = recyclelist.size()/getCollectionRate();
-    if( multiplier < getCollectionRate() ) multiplier = getCollectionRate();
-	
-	for( unsigned int i = 0; i < multiplier; ++i )
-	{
-		if( ! recyclelist.empty() )
-		{
-			boost::intrusive_ptr<BatchGeometry>& g = recyclelist.back();
-			if( g )
-				removeProper( g );
-			recyclelist.pop_back();
-		}
-		else
-		{
-			break;
-		}
-	}
-}
-
-/*!
-	Main drawing routine,
-	this is the meat of phoenix, all of the important stuff goes here.
-*/
-void BatchRenderer::draw( bool _persist_immediate )
-{
-
-	persist_immediate = _persist_immediate;
-
-	//Do we have a shader? Activate it
-	if( shader ) shader->activate();
-
-	//If we have a render target active, set it. Don't keep drawing if it failed.
-	if( target ){
-		if( target->start() ){
-			target->modifyView(view);
-		} else {
-			return;
-		}
-	}
-
-	//Clear
-	if( enable_clear ) clearScreen(clear_color);
-
-    // View.
-    view.activate();
-
-	// push the modelview matrix (the view activate() function definitely put is in modelview mode).
-	glPushMatrix();
-
-    // Enable states
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-    glEnableClientState(GL_COLOR_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
-
-	//vector to store vertices.
-	std::vector< Vertex > vlist;
-    vlist.reserve( 1000 );
-
-	//clipping variables
-	bool clipping = false;
-	Rectangle clipping_rect;
-
-	//iterate through the graph.
-	boost::recursive_mutex::scoped_lock l( getMutex() );
-
-	//depth
-    BATCHMAPDELTA::iterator deltaend = geometry.end();
-    for( BATCHMAPDELTA::iterator deltapair = geometry.begin(); deltapair != deltaend; /*Incremented in pruning logic*/ )
-	{
-
-		//Iterate through each group
-        BATCHMAPGAMMA::iterator gammaend = deltapair->second.end();
-        for( BATCHMAPGAMMA::iterator gammapair = deltapair->second.begin(); gammapair != gammaend; /*Incremented in pruning logic*/ )
-		{
-
-			//activate the group state
-			GROUPSTATEMAP::iterator gs = groupstates.find( gammapair->first );
-			if( gs != groupstates.end() ) gs->second->begin( *this );
-
-			//Iterate through each texture.
-            BATCHMAPBETA::iterator betaend = gammapair->second.end();
-			for( BATCHMAPBETA::iterator betapair = gammapair->second.begin(); betapair != betaend; /*Incremented in pruning logic*/ )
-			{
-
-				betapair->first == 0 ? glDisable(GL_TEXTURE_2D) : glEnable(GL_TEXTURE_2D); // should we texture? 
-				bool texture_set = false; // will be set by the first geom.
-
-				// Now run down through each primitive type
-                BATCHMAPALPHA::iterator alphaend = betapair->second.end();
-				for( BATCHMAPALPHA::iterator alphapair = betapair->second.begin(); alphapair != alphaend; /*Incremented in pruning logic*/ )
-				{
-
-					//now loop for each piece of geometry.
-                    GEOMCONTAINER::iterator geomend = alphapair->second.end();
-                    for( GEOMCONTAINER::iterator geom = alphapair->second.begin(); geom != geomend; ++geom )
-                    {
-						if( (*geom) && ! (*geom)->dropped() && (*geom)->getEnabled() )
-						{
-							// Set the texture. 
-							if( betapair->first != 0 && !texture_set ){
-								if( (*geom)->getTexture() ){
-									(*geom)->getTexture()->bind();
-									texture_set = true;
-								}
-							}
-
-							try{
-								
-								// Check for clipping, and if clipped, skip batching.
-								if( clipGeometry( *geom, clipping, clipping_rect ) ) continue;
-
-								/* Batch the vertices */
-								(*geom)->batch( vlist, persist_immediate );
-								
-								/* Do not accumulate for tri strips, line strips, line loops, triangle fans, quad strips, or polygons */
-								if( alphapair->first == GL_LINE_STRIP ||
-									alphapair->first == GL_LINE_LOOP ||
-									alphapair->first == GL_TRIANGLE_STRIP ||
-									alphapair->first == GL_TRIANGLE_FAN ||
-									alphapair->first == GL_QUAD_STRIP ||
-									alphapair->first == GL_POLYGON ){
-										// Send it on, this will also clear the list for the next geom so it doesn't acccumlate as usual.
-										submitVertexList(vlist,alphapair->first);
-								}
-
-
-							}catch(...)
-							{
-								assert( false ); // Not enough space.
-							}
-						}
-					}
-
-					// Send it on
-					submitVertexList(vlist,alphapair->first);
-
-					// pruning logic. 
-					if( alphapair->second.empty() ){
-						betapair->second.erase(alphapair++);
-					} else {
-						++alphapair; //business as usual
-					}
-
-				} // Primitive Type
-
-				// pruning logic. 
-				if( betapair->second.empty() ){
-					gammapair->second.erase(betapair++);
-				} else {
-					++betapair; //business as usual
-				}
-
-			} // Texture
-
-			// call the end group function
-			if( gs != groupstates.end() ) gs->second->end( *this );
-
-			// pruning logic. 
-			if( gammapair->second.empty() ){
-				deltapair->second.erase(gammapair++);
-			} else {
-				++gammapair; //business as usual
-			}
-
-		} // Group
-
-		// pruning logic. 
-		if( deltapair->second.empty() ){
-			geometry.erase(deltapair++);
-		} else {
-			++deltapair; //business as usual
-		}
-
-	} //depth
-
-    // disable states
-    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-    glDisableClientState(GL_COLOR_ARRAY);
-    glDisableClientState(GL_VERTEX_ARRAY);
-
-	//matrix
-	glPopMatrix();
-
-	//If we have a render target active, and it was in use, unbind it now.
-	if( target ){
-		target->end();
-		target->restoreView(view);
-	}
-
-	//Do we have a shader? deactivate it
-	if( shader ) shader->deactivate();
-
-	//Do we have clipping enabled?
-	if(clipping) {
-		glDisable( GL_SCISSOR_TEST );		
-	}
-
-	// Prune.
-	clean();
-
-}
-
-/*!
-	Clipping Routine
-*/
-bool BatchRenderer::clipGeometry(  boost::intrusive_ptr<BatchGeometry> geom, bool &clipping, phoenix::Rectangle &clipping_rect ){
-	// Check for clipping
-	if( geom->getClipping() ){
-									
-		//enable clipping, if we're not already doing it.
-		if( !clipping ){
-			glEnable( GL_SCISSOR_TEST );
-			clipping = true;
-		}
-
-		// set the clip area, if it's not already the same.
-		if( clipping_rect != geom->getClippingRectangle()){
-			clipping_rect = geom->getClippingRectangle();
-
-			// translate from top-left coords to bottom-left cords
-			GLint view[4];
-			glGetIntegerv( GL_VIEWPORT, &view[0] );
-			GLuint r_y = view[3] - ((GLuint)clipping_rect.getX() + (GLuint)clipping_rect.getHeight());
-
-			glScissor( (GLuint)clipping_rect.getX() , r_y, (GLsizei)clipping_rect.getWidth(), (GLsizei)clipping_rect.getHeight() );
-		}
-
-		std::vector< Vertex > t_vlist;
-		geom->batch( t_vlist, persist_immediate );
-		submitVertexList(t_vlist,geom->getPrimitiveType());
-
-		return true;
-
-	} 
-	else {
-									
-		//disable clipping, if we're still doing it
-		if( clipping ){
-			glDisable( GL_SCISSOR_TEST );
-			clipping = false;
-		}
-
-		return false;
-	}
-}
-
-/*!
-	Vertex submission routine.
-	Sends data to opengl
-*/
-void BatchRenderer::submitVertexList( std::vector< Vertex >& vlist, unsigned int type ){
-	if( vlist.empty() ) return;
-
-    glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), &vlist[0].tcoords);
-    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), &vlist[0].color);
-    glVertexPointer(3, GL_FLOAT, sizeof(Vertex), &vlist[0].position);
-
-	glDrawArrays( type, 0, vlist.size() );
-
-    //clear the vlist
-	vlist.clear();
-}
-
-/* Immediate drawing routine, fairly simple */
-void BatchRenderer::drawImmediately(  boost::intrusive_ptr<BatchGeometry> geom ){
-
-	if( !geom ) return;
-
-	//If we have a render target active, set it. Don't keep drawing if it failed.
-	if( target && !target->start() ) return;
-
-	// View.
-    view.activate();
-
-	// matrix stuff
-	glMatrixMode( GL_MODELVIEW );
-	glPushMatrix();
-
-    // Enable states
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-    glEnableClientState(GL_COLOR_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
-
-	//activate the group state
-	GROUPSTATEMAP::iterator gs = groupstates.find( geom->getGroup() );
-	if( gs != groupstates.end() ) gs->second->begin( *this );
-
-	//set our texture
-	if( (geom->getTextureId()) ){
-		glEnable( GL_TEXTURE_2D );
-		geom->getTexture()->bind();
-	}
-	else{
-		glDisable( GL_TEXTURE_2D );
-	}
-
-	// Check for clipping, and if clipped, skip regular rendering.
-	bool clipping = false;
-	Rectangle clipping_rect;
-	if( !clipGeometry( geom, clipping, clipping_rect ) ){
-		std::vector< Vertex > t_vlist;
-		geom->batch( t_vlist );
-		submitVertexList(t_vlist,geom->getPrimitiveType());
-	} else {
-		//disable clipping
-		glDisable( GL_SCISSOR_TEST );
-	}
-
-
-	// call the end group function
-	if( gs != groupstates.end() ) gs->second->end( *this );
-
-    // disable states
-    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-    glDisableClientState(GL_COLOR_ARRAY);
-    glDisableClientState(GL_VERTEX_ARRAY);
-
-	//matrix
-	glPopMatrix();
-
-	//If we have a render target active, and it was in use, unbind it now.
-	if( target ){
-		target->end();
-	}
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+//Uncomment this for really annoying spam on msvc compilers.
+//#pragma warning( disable : 4503 )
+#include <boost/static_assert.hpp>
+#include <boost/unordered_set.hpp>
+#include "BatchRenderer.h"
+
+using namespace boost;
+using namespace phoenix;
+using namespace std;
+
+// There can be hundreds of thousands of BatchGeometry, so keep it from growing past its flags
+// (which share Droppable's padding), its vertices, four pointers, and two graph keys.
+BOOST_STATIC_ASSERT( sizeof( BatchGeometry ) <= sizeof( Droppable ) + sizeof( VertexList ) + 4 * sizeof( void* ) + 2 * sizeof( BatchGeometry::Key ) );
+
+#ifdef DEBUG_BATCHRENDERER
+//! Lists all the geometry in the list.
+void BatchRenderer::listGeometry()
+{
+	BOOST_FOREACH( BATCHMAPDELTA::value_type& deltapair, geometry ){
+		BOOST_FOREACH( BATCHMAPGAMMA::value_type& gammapair, deltapair.second ){
+			BOOST_FOREACH( BATCHMAPBETA::value_type& betapair, gammapair.second ){
+				BOOST_FOREACH( BATCHMAPALPHA::value_type& alphapair, betapair.second ){
+					BOOST_FOREACH( intrusive_ptr<BatchGeometry>& geom, alphapair.second.geoms )
+					{
+						std::cout<<"\n Geometry "<<geom.get()
+							<<" at "
+							<<deltapair.first
+							<<", "<<gammapair.first
+							<<", "<<betapair.first
+							<<", "<<alphapair.first
+							<<" with properties "<<geom->getDepth()
+							<<", "<<geom->getGroup()
+							<<", "<<geom->getTextureId()
+							<<", "<<geom->getPrimitiveType();
+					}
+					std::cout<<"\n "<<alphapair.second.transient.size()<<" arena geometry at "
+						<<deltapair.first
+						<<", "<<gammapair.first
+						<<", "<<betapair.first
+						<<", "<<alphapair.first;
+				}
+			}
+		}
+	}
+}
+#endif
+
+unsigned int BatchRenderer::count()
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	unsigned int total = 0;
+	BOOST_FOREACH( BATCHMAPDELTA::value_type& deltapair, geometry ){
+		BOOST_FOREACH( BATCHMAPGAMMA::value_type& gammapair, deltapair.second ){
+			BOOST_FOREACH( BATCHMAPBETA::value_type& betapair, gammapair.second ){
+				BOOST_FOREACH( BATCHMAPALPHA::value_type& alphapair, betapair.second ){
+					total += alphapair.second.geoms.size() + alphapair.second.transient.size();
+				}
+			}
+		}
+	}
+	BOOST_FOREACH( BATCHMAPGAMMA::value_type& gammapair, opaque_geometry ){
+		BOOST_FOREACH( BATCHMAPBETA::value_type& betapair, gammapair.second ){
+			BOOST_FOREACH( BATCHMAPALPHA::value_type& alphapair, betapair.second ){
+				total += alphapair.second.geoms.size() + alphapair.second.transient.size();
+			}
+		}
+	}
+	return total;
+}
+
+
+void BatchRenderer::add( boost::intrusive_ptr<BatchGeometry> _g )
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	Bucket& bucket = bucketFor( _g->getDepth(), _g->getGroup(), _g->getTextureId(), _g->getPrimitiveType(), _g->getOpaque(), _g->getTransient() );
+	if( layer_step > 0 ) ++depth_counts[ _g->getDepth() ];
+	if( _g->getTransient() )
+		bucket.transient.push_back( _g.get() );
+	else
+		bucket.geoms.push_back( _g );
+}
+
+boost::intrusive_ptr<BatchGeometry> BatchRenderer::createImmediate( unsigned int _p, TexturePtr _t, signed int _g, float _d, bool _o )
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+
+	boost::intrusive_ptr<BatchGeometry> geom;
+	if( arena_used < arena.size() )
+	{
+		// Reuse last frame's geometry, along with its vertex storage.
+		geom = arena[arena_used];
+		geom->recycle( _p, _t, _g, _d, _o );
+	}
+	else
+	{
+		geom = new BatchGeometry( *this, _p, _t, _g, _d, _o, true );
+		arena.push_back( geom );
+	}
+	++arena_used;
+
+	add( geom );
+	return geom;
+}
+
+void BatchRenderer::remove( boost::intrusive_ptr<BatchGeometry> _g )
+{
+	// Arena geometry is taken out of the graph all at once after drawing.
+	if( _g->getTransient() ) return;
+
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	recyclelist.push_back( _g );
+}
+
+void BatchRenderer::removeProper( boost::intrusive_ptr<BatchGeometry> _g, bool _inv )
+{
+
+	unsigned int textureid = _g->getTextureId();
+	signed int groupid = _g->getGroup();
+	unsigned int primitivetype = _g->getPrimitiveType();
+	float depth = _g->getDepth();
+	bool opaque = _g->getOpaque();
+
+	if( _inv == true ) {// we're using the previous value
+		const BatchGeometry::Key& placed = _g->getPlacedKey();
+		groupid = placed.group;
+		primitivetype = placed.primitive;
+		depth = placed.depth;
+		textureid = placed.texture;
+		opaque = placed.opaque;
+	}
+
+	//lock the mutex
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+
+	Bucket& bucket = bucketFor( depth, groupid, textureid, primitivetype, opaque, _g->getTransient() );
+	if( _g->getTransient() )
+	{
+		std::vector< BatchGeometry* >& container = bucket.transient;
+		std::vector< BatchGeometry* >::iterator f = std::find( container.begin(), container.end(), _g.get() );
+		if( f != container.end() )
+		{
+			// The ol' pop & swap; 
+			boost::swap( (*f) , container.back() );
+			container.pop_back();
+			forgetDepth( _g->getPlacedKey().depth );
+		}
+		return;
+	}
+
+	GEOMCONTAINER* container = &bucket.geoms;
+	GEOMCONTAINER::iterator f = std::find( container->begin(), container->end(), _g );
+	if( f != container->end() )
+	{
+		// The ol' pop & swap; 
+		boost::swap( (*f) , container->back() );
+		container->pop_back();
+		forgetDepth( _g->getPlacedKey().depth );
+	}
+	else
+	{
+		//throw;
+	}
+}
+
+void BatchRenderer::resetArena()
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+
+	for( unsigned int i = 0; i < arena_used; )
+	{
+		boost::intrusive_ptr<BatchGeometry> geom = arena[i];
+		bool promote = ! geom->getImmediate() && ! geom->dropped();
+
+		// Made persistent or still held elsewhere (besides the arena and geom), so it leaves the arena.
+		if( promote || geom->getReferenceCount() > 2 )
+		{
+			geom->transient = false;
+
+			--arena_used;
+			boost::swap( arena[i], arena[arena_used] );
+			boost::swap( arena[arena_used], arena.back() );
+			arena.pop_back();
+
+			if( promote )
+			{
+				geom->settle();
+				add( geom );
+			}
+		}
+		else
+		{
+			++i;
+		}
+	}
+
+	arena_used = 0;
+}
+
+void BatchRenderer::move( boost::intrusive_ptr<BatchGeometry> _g )
+{
+	lock();
+	const BatchGeometry::Key& placed = _g->getPlacedKey();
+	const bool was_opaque = filesOpaque( placed.depth, placed.opaque ), is_opaque = filesOpaque( _g->getDepth(), _g->getOpaque() );
+	if( placed.group == _g->getGroup() && placed.texture == _g->getTextureId() && placed.primitive == _g->getPrimitiveType()
+		&& was_opaque == is_opaque && ( is_opaque || getLayerDepth( placed.depth ) == getLayerDepth( _g->getDepth() ) ) )
+	{
+		// Still in the same layer (opaque geometry isn't filed by depth at all), so it stays where it is.
+		if( layer_step > 0 )
+		{
+			forgetDepth( placed.depth );
+			++depth_counts[ _g->getDepth() ];
+		}
+	}
+	else
+	{
+		removeProper( _g, true );
+		add( _g );
+	}
+	unlock();
+}
+
+void BatchRenderer::setOpaquePass( bool _o )
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	const bool was_used = usingOpaquePass();
+	opaque_pass = _o;
+	if( usingOpaquePass() != was_used ) relayer();
+}
+
+/*!
+	The library is built with DISABLE_DEPTHBUFFER or not, so it's checked here rather than in the header.
+*/
+bool BatchRenderer::usingOpaquePass() const
+{
+#ifdef DISABLE_DEPTHBUFFER
+	return false;
+#else
+	return opaque_pass && ! target;
+#endif
+}
+
+void BatchRenderer::setRenderTarget( RenderTargetPtr _t )
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	const bool was_used = usingOpaquePass();
+	target = _t;
+	if( usingOpaquePass() != was_used ) relayer();
+}
+
+void BatchRenderer::setLayerSort( float _depth, E_LAYER_SORT _sort )
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	const float layer = getLayerDepth( _depth );
+	if( ( sorted_layers.find( layer ) != sorted_layers.end() ) == ( _sort == ELS_Y ) ) return;
+
+	if( _sort == ELS_Y )
+		sorted_layers[ layer ];
+	else
+		sorted_layers.erase( layer );
+
+	// Opaque geometry in the layer moves between the opaque graph and the layer.
+	if( usingOpaquePass() ) relayer();
+}
+
+E_LAYER_SORT BatchRenderer::getLayerSort( float _depth )
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	return sorted_layers.find( getLayerDepth( _depth ) ) != sorted_layers.end() ? ELS_Y : ELS_STATE;
+}
+
+void BatchRenderer::setDepthQuantization( float _step )
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	layer_step = _step > 0 ? _step : 0;
+	layer_min = 0;
+	layer_count = 0;
+	relayer();
+}
+
+void BatchRenderer::setDepthLayers( unsigned int _layers, float _min, float _max )
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	if( _layers > 0 && _max > _min )
+	{
+		layer_step = ( _max - _min ) / _layers;
+		layer_min = _min;
+		layer_count = _layers;
+	}
+	else
+	{
+		layer_step = 0;
+		layer_min = 0;
+		layer_count = 0;
+	}
+	relayer();
+}
+
+unsigned int BatchRenderer::getDepthLayerCount()
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	return geometry.size();
+}
+
+unsigned int BatchRenderer::getDistinctDepthCount()
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	return layer_step > 0 ? depth_counts.size() : geometry.size();
+}
+
+void BatchRenderer::relayer()
+{
+	BATCHMAPDELTA old;
+	BATCHMAPGAMMA old_opaque;
+	old.swap( geometry );
+	old_opaque.swap( opaque_geometry );
+	depth_counts.clear();
+
+	// Y sorted layers go with whatever layer their depth is in now, and are sorted from scratch.
+	SORTEDLAYERMAP old_sorted;
+	old_sorted.swap( sorted_layers );
+	BOOST_FOREACH( SORTEDLAYERMAP::value_type& sortedpair, old_sorted ){
+		sorted_layers[ getLayerDepth( sortedpair.first ) ];
+	}
+
+	BOOST_FOREACH( BATCHMAPDELTA::value_type& deltapair, old ){
+		refile( deltapair.second );
+	}
+	refile( old_opaque );
+}
+
+void BatchRenderer::refile( BATCHMAPGAMMA& _groups )
+{
+	// Everything keeps its group, texture, and primitive type, only which graph and depth it's filed under changes.
+	BOOST_FOREACH( BATCHMAPGAMMA::value_type& gammapair, _groups ){
+		BOOST_FOREACH( BATCHMAPBETA::value_type& betapair, gammapair.second ){
+			BOOST_FOREACH( BATCHMAPALPHA::value_type& alphapair, betapair.second ){
+				BOOST_FOREACH( intrusive_ptr<BatchGeometry>& geom, alphapair.second.geoms ){
+					const BatchGeometry::Key& placed = geom->getPlacedKey();
+					bucketFor( placed.depth, gammapair.first, betapair.first, alphapair.first, placed.opaque ).geoms.push_back( geom );
+					if( layer_step > 0 ) ++depth_counts[ placed.depth ];
+				}
+				BOOST_FOREACH( BatchGeometry* geom, alphapair.second.transient ){
+					const BatchGeometry::Key& placed = geom->getPlacedKey();
+					bucketFor( placed.depth, gammapair.first, betapair.first, alphapair.first, placed.opaque, true ).transient.push_back( geom );
+					if( layer_step > 0 ) ++depth_counts[ placed.depth ];
+				}
+			}
+		}
+	}
+}
+
+void BatchRenderer::forgetDepth( float _depth )
+{
+	if( layer_step <= 0 ) return;
+	boost::unordered_map< float, unsigned int >::iterator it = depth_counts.find( _depth );
+	if( it != depth_counts.end() && --it->second == 0 ) depth_counts.erase( it );
+}
+
+
+void BatchRenderer::clean()
+{
+	
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+
+    unsigned int multiplier = recyclelist.size()/getCollectionRate();
+    if( multiplier < getCollectionRate() ) multiplier = getCollectionRate();
+	
+	for( unsigned int i = 0; i < multiplier; ++i )
+	{
+		if( ! recyclelist.empty() )
+		{
+			boost::intrusive_ptr<BatchGeometry>& g = recyclelist.back();
+			if( g )
+				removeProper( g );
+			recyclelist.pop_back();
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+/*!
+	Main drawing routine,
+	this is the meat of phoenix, all of the important stuff goes here.
+*/
+void BatchRenderer::draw( bool _persist_immediate )
+{
+
+	persist_immediate = _persist_immediate;
+
+	//Do we have a shader? Activate it
+	if( shader ) shader->activate();
+
+	//If we have a render target active, set it. Don't keep drawing if it failed.
+	if( target ){
+		if( target->start() ){
+			target->modifyView(view);
+		} else {
+			return;
+		}
+	}
+
+	//Clear
+	if( enable_clear ) clearScreen(clear_color);
+
+    // View.
+    view.activate();
+
+	// push the modelview matrix (the view activate() function definitely put is in modelview mode).
+	glPushMatrix();
+
+    // Enable states (they're left on, so this only costs anything the first time)
+    GLState::setClientState(GL_TEXTURE_COORD_ARRAY, true);
+    GLState::setClientState(GL_COLOR_ARRAY, true);
+    GLState::setClientState(GL_VERTEX_ARRAY, true);
+
+	//clipping variables
+	bool clipping = false;
+	Rectangle clipping_rect;
+
+	//iterate through the graph.
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	group_switches = elided_group_switches = 0;
+
+	//opaque geometry first, across all depths.
+	if( usingOpaquePass() ) drawGroups( opaque_geometry, clipping, clipping_rect );
+
+	//depth
+    BATCHMAPDELTA::iterator deltaend = geometry.end();
+    for( BATCHMAPDELTA::iterator deltapair = geometry.begin(); deltapair != deltaend; /*Incremented in pruning logic*/ )
+	{
+
+		SORTEDLAYERMAP::iterator sorted = sorted_layers.empty() ? sorted_layers.end() : sorted_layers.find( deltapair->first );
+		if( sorted != sorted_layers.end() )
+			drawSorted( sorted->second, deltapair->second, clipping, clipping_rect );
+		else
+			drawGroups( deltapair->second, clipping, clipping_rect );
+
+		// pruning logic. 
+		if( deltapair->second.empty() ){
+			geometry.erase(deltapair++);
+		} else {
+			++deltapair; //business as usual
+		}
+
+	} //depth
+
+	// end the last group state.
+	leaveGroup();
+
+	//matrix
+	glPopMatrix();
+
+	//If we have a render target active, and it was in use, unbind it now.
+	if( target ){
+		target->end();
+		target->restoreView(view);
+	}
+
+	//Do we have a shader? deactivate it
+	if( shader ) shader->deactivate();
+
+	//Do we have clipping enabled?
+	if(clipping) {
+		GLState::disable( GL_SCISSOR_TEST );		
+	}
+
+	// Let go of this frame's arena geometry.
+	if( ! persist_immediate ) resetArena();
+
+	// Prune.
+	clean();
+
+}
+
+/*!
+	Draws each group, texture, and primitive type under one depth (or the opaque pass),
+	pruning whatever's become empty.
+*/
+void BatchRenderer::drawGroups( BATCHMAPGAMMA& _groups, bool& _clipping, phoenix::Rectangle& _clipping_rect )
+{
+	// Carry on with the group that's still active, if it's here, so its state doesn't have to be switched.
+	BATCHMAPGAMMA::iterator carried = active_state ? _groups.find( active_group ) : _groups.end();
+	if( carried != _groups.end() ) drawGroup( carried->first, carried->second, _clipping, _clipping_rect );
+
+	//Iterate through each group
+    BATCHMAPGAMMA::iterator gammaend = _groups.end();
+    for( BATCHMAPGAMMA::iterator gammapair = _groups.begin(); gammapair != gammaend; /*Incremented in pruning logic*/ )
+	{
+
+		if( gammapair != carried ) drawGroup( gammapair->first, gammapair->second, _clipping, _clipping_rect );
+
+		// pruning logic. 
+		if( gammapair->second.empty() ){
+			_groups.erase(gammapair++);
+		} else {
+			++gammapair; //business as usual
+		}
+
+	} // Group
+}
+
+/*!
+	Draws each texture and primitive type in a group, pruning whatever's become empty.
+*/
+void BatchRenderer::drawGroup( signed int _group, BATCHMAPBETA& _textures, bool& _clipping, phoenix::Rectangle& _clipping_rect )
+{
+	//activate the group state
+	enterGroup( _group );
+
+	//Iterate through each texture.
+    BATCHMAPBETA::iterator betaend = _textures.end();
+	for( BATCHMAPBETA::iterator betapair = _textures.begin(); betapair != betaend; /*Incremented in pruning logic*/ )
+	{
+
+		GLState::setEnabled( GL_TEXTURE_2D, betapair->first != 0 ); // should we texture? 
+		bool texture_set = false; // will be set by the first geom.
+
+		// Now run down through each primitive type
+        BATCHMAPALPHA::iterator alphaend = betapair->second.end();
+		for( BATCHMAPALPHA::iterator alphapair = betapair->second.begin(); alphapair != alphaend; /*Incremented in pruning logic*/ )
+		{
+
+			//now loop for each piece of geometry.
+            GEOMCONTAINER::iterator geomend = alphapair->second.geoms.end();
+            for( GEOMCONTAINER::iterator geom = alphapair->second.geoms.begin(); geom != geomend; ++geom )
+            {
+				batchGeometry( geom->get(), betapair->first, alphapair->first, texture_set, vlist, _clipping, _clipping_rect );
+			}
+
+			// then the arena geometry, which is let go of all at once.
+			std::vector< BatchGeometry* >& transient = alphapair->second.transient;
+			for( unsigned int i = 0; i < transient.size(); ++i )
+			{
+				batchGeometry( transient[i], betapair->first, alphapair->first, texture_set, vlist, _clipping, _clipping_rect );
+			}
+			if( ! persist_immediate )
+			{
+				if( layer_step > 0 )
+					for( unsigned int i = 0; i < transient.size(); ++i ) forgetDepth( transient[i]->getPlacedKey().depth );
+				transient.clear();
+			}
+
+			// Send it on
+			submitVertexList(vlist,alphapair->first);
+
+			// pruning logic. 
+			if( alphapair->second.empty() ){
+				betapair->second.erase(alphapair++);
+			} else {
+				++alphapair; //business as usual
+			}
+
+		} // Primitive Type
+
+		// pruning logic. 
+		if( betapair->second.empty() ){
+			_textures.erase(betapair++);
+		} else {
+			++betapair; //business as usual
+		}
+
+	} // Texture
+
+	// the group state is ended when the next group is entered, or by leaveGroup().
+}
+
+/*!
+	Switches to the group state for _group. If the state that's active says the new one is equivalent,
+	the end() and begin() are skipped.
+*/
+void BatchRenderer::enterGroup( signed int _group )
+{
+	GROUPSTATEMAP::iterator gs = groupstates.find( _group );
+	GroupStatePtr next = gs != groupstates.end() ? gs->second : GroupStatePtr();
+	active_group = _group;
+
+	if( ! active_state && ! next ) return;
+	++group_switches;
+
+	if( active_state && next && next->isEquivalent( *active_state ) )
+	{
+		++elided_group_switches;
+		active_state = next;
+		return;
+	}
+
+	if( active_state ) active_state->end( *this );
+	active_state = next;
+	if( active_state ) active_state->begin( *this );
+}
+
+/*!
+	Ends the active group state, if any.
+*/
+void BatchRenderer::leaveGroup()
+{
+	if( active_state ) active_state->end( *this );
+	active_state.reset();
+}
+
+/*!
+	Draws a Y sorted layer. The order from last time is fixed up with an insertion sort, which is close to
+	linear when things have only moved a little. Geometry that's new to the layer is sorted on its own and
+	merged in. Arena geometry only lasts a frame, so it's sorted on its own every frame and merged in as it's
+	drawn, without touching the kept order.
+*/
+void BatchRenderer::drawSorted( SortedLayer& _layer, BATCHMAPGAMMA& _groups, bool& _clipping, phoenix::Rectangle& _clipping_rect )
+{
+	std::vector< SortEntry >& entries = _layer.entries;
+	std::vector< SortEntry >& transients = _layer.transients;
+	std::vector< SortEntry >::size_type kept = entries.size();
+
+	transients.clear();
+	BOOST_FOREACH( BATCHMAPGAMMA::value_type& gammapair, _groups ){
+		BOOST_FOREACH( BATCHMAPBETA::value_type& betapair, gammapair.second ){
+			BOOST_FOREACH( BATCHMAPALPHA::value_type& alphapair, betapair.second ){
+				BOOST_FOREACH( BatchGeometry* geom, alphapair.second.transient )
+				{
+					SortEntry e = { geom->getSortY(), geom };
+					transients.push_back( e );
+				}
+			}
+		}
+	}
+	std::sort( transients.begin(), transients.end() );
+
+	if( _layer.changed )
+	{
+		// Everything kept in the layer now.
+		boost::unordered_set< BatchGeometry* > members;
+		BOOST_FOREACH( BATCHMAPGAMMA::value_type& gammapair, _groups ){
+			BOOST_FOREACH( BATCHMAPBETA::value_type& betapair, gammapair.second ){
+				BOOST_FOREACH( BATCHMAPALPHA::value_type& alphapair, betapair.second ){
+					BOOST_FOREACH( intrusive_ptr<BatchGeometry>& geom, alphapair.second.geoms ) members.insert( geom.get() );
+				}
+			}
+		}
+
+		// Keep what's still here in the same order (without touching what isn't, it may be gone), then add the rest.
+		kept = 0;
+		for( std::vector< SortEntry >::size_type i = 0; i < entries.size(); ++i )
+		{
+			if( members.erase( entries[i].geom ) ) entries[kept++] = entries[i];
+		}
+		entries.resize( kept );
+		BOOST_FOREACH( BatchGeometry* geom, members )
+		{
+			SortEntry e = { 0.0f, geom };
+			entries.push_back( e );
+		}
+		_layer.changed = false;
+	}
+
+	for( std::vector< SortEntry >::size_type i = 0; i < entries.size(); ++i )
+		entries[i].key = entries[i].geom->getSortY();
+
+	// Insertion sort on what was here last frame.
+	for( std::vector< SortEntry >::size_type i = 1; i < kept; ++i )
+	{
+		SortEntry e = entries[i];
+		std::vector< SortEntry >::size_type j = i;
+		for( ; j > 0 && e.key < entries[j-1].key; --j ) entries[j] = entries[j-1];
+		entries[j] = e;
+	}
+
+	// New geometry is in no particular order, so it gets a full sort.
+	if( kept < entries.size() )
+	{
+		std::sort( entries.begin() + kept, entries.end() );
+		std::inplace_merge( entries.begin(), entries.begin() + kept, entries.end() );
+	}
+
+	// Draw in order, merging in the arena geometry, and batching runs with the same group, texture, and primitive type.
+	bool running = false, texture_set = false;
+	signed int group = 0;
+	unsigned int texture = 0, primitive = 0;
+	std::vector< SortEntry >::size_type i = 0, t = 0;
+	while( i < entries.size() || t < transients.size() )
+	{
+		BatchGeometry* geom = ( t == transients.size() || ( i < entries.size() && ! ( transients[t] < entries[i] ) ) )
+			? entries[i++].geom : transients[t++].geom;
+
+		const BatchGeometry::Key& key = geom->getPlacedKey();
+		if( ! running || key.group != group || key.texture != texture || key.primitive != primitive )
+		{
+			if( running ) submitVertexList( vlist, primitive );
+			if( ! running || key.group != group ) enterGroup( key.group );
+			if( ! running || key.texture != texture )
+			{
+				GLState::setEnabled( GL_TEXTURE_2D, key.texture != 0 );
+				texture_set = false;
+			}
+			group = key.group;
+			texture = key.texture;
+			primitive = key.primitive;
+			running = true;
+		}
+		batchGeometry( geom, texture, primitive, texture_set, vlist, _clipping, _clipping_rect );
+	}
+	if( running ) submitVertexList( vlist, primitive );
+
+	// Arena geometry that was just let go of isn't in the kept order, so it doesn't change the layer.
+	pruneGroups( _groups );
+}
+
+/*!
+	Empties the transient lists after drawing, and prunes empty parts of the graph.
+*/
+void BatchRenderer::pruneGroups( BATCHMAPGAMMA& _groups )
+{
+	for( BATCHMAPGAMMA::iterator gammapair = _groups.begin(); gammapair != _groups.end(); )
+	{
+		for( BATCHMAPBETA::iterator betapair = gammapair->second.begin(); betapair != gammapair->second.end(); )
+		{
+			for( BATCHMAPALPHA::iterator alphapair = betapair->second.begin(); alphapair != betapair->second.end(); )
+			{
+				std::vector< BatchGeometry* >& transient = alphapair->second.transient;
+				if( ! persist_immediate && ! transient.empty() )
+				{
+					if( layer_step > 0 )
+						for( unsigned int i = 0; i < transient.size(); ++i ) forgetDepth( transient[i]->getPlacedKey().depth );
+					transient.clear();
+				}
+				if( alphapair->second.empty() ) betapair->second.erase( alphapair++ ); else ++alphapair;
+			}
+			if( betapair->second.empty() ) gammapair->second.erase( betapair++ ); else ++betapair;
+		}
+		if( gammapair->second.empty() ) _groups.erase( gammapair++ ); else ++gammapair;
+	}
+}
+
+/*!
+	Batches a single piece of geometry into the vertex list.
+*/
+void BatchRenderer::batchGeometry( BatchGeometry* _geom, unsigned int _texture, unsigned int _primitive, bool& _texture_set, VertexBatch& _vlist, bool& _clipping, phoenix::Rectangle& _clipping_rect )
+{
+	if( _geom && ! _geom->dropped() && _geom->getEnabled() )
+	{
+		// Set the texture. 
+		if( _texture != 0 && !_texture_set ){
+			if( _geom->getTexture() ){
+				_geom->getTexture()->bind();
+				_texture_set = true;
+			}
+		}
+
+		try{
+			
+			// Check for clipping, and if clipped, skip batching.
+			if( clipGeometry( _geom, _clipping, _clipping_rect ) ) return;
+
+			/* Batch the vertices */
+			batchInto( _geom, _vlist, persist_immediate );
+			
+			/* Do not accumulate for tri strips, line strips, line loops, triangle fans, quad strips, or polygons */
+			if( _primitive == GL_LINE_STRIP ||
+				_primitive == GL_LINE_LOOP ||
+				_primitive == GL_TRIANGLE_STRIP ||
+				_primitive == GL_TRIANGLE_FAN ||
+				_primitive == GL_QUAD_STRIP ||
+				_primitive == GL_POLYGON ){
+					// Send it on, this will also clear the list for the next geom so it doesn't acccumlate as usual.
+					submitVertexList(_vlist,_primitive);
+			}
+
+
+		}catch(...)
+		{
+			assert( false ); // Not enough space.
+		}
+	}
+}
+
+/*!
+	Clipping Routine
+*/
+bool BatchRenderer::clipGeometry(  boost::intrusive_ptr<BatchGeometry> geom, bool &clipping, phoenix::Rectangle &clipping_rect ){
+	// Check for clipping
+	if( geom->getClipping() ){
+									
+		//enable clipping, if we're not already doing it.
+		if( !clipping ){
+			GLState::enable( GL_SCISSOR_TEST );
+			clipping = true;
+		}
+
+		// set the clip area, if it's not already the same.
+		if( clipping_rect != geom->getClippingRectangle()){
+			clipping_rect = geom->getClippingRectangle();
+
+			// translate from top-left coords to bottom-left cords
+			const GLint* view = GLState::getViewport();
+			GLuint r_y = view[3] - ((GLuint)clipping_rect.getX() + (GLuint)clipping_rect.getHeight());
+
+			GLState::scissor( (GLuint)clipping_rect.getX() , r_y, (GLsizei)clipping_rect.getWidth(), (GLsizei)clipping_rect.getHeight() );
+		}
+
+		batchInto( geom.get(), clip_vlist, persist_immediate );
+		submitVertexList(clip_vlist,geom->getPrimitiveType());
+
+		return true;
+
+	} 
+	else {
+									
+		//disable clipping, if we're still doing it
+		if( clipping ){
+			GLState::disable( GL_SCISSOR_TEST );
+			clipping = false;
+		}
+
+		return false;
+	}
+}
+
+/*!
+	Writes the geometry's vertices into the list's storage, which is grown first if there isn't room.
+	With the opaque pass, the depth buffer keeps things in order, so z comes from the layer's depth.
+*/
+unsigned int BatchRenderer::batchInto( BatchGeometry* _geom, VertexBatch& _vlist, bool _persist )
+{
+	const unsigned int start = _vlist.size;
+	const unsigned int written = _geom->batchInto( _vlist.extend( _geom->getBatchSize() ), _persist );
+	_vlist.size += written;
+
+	if( usingOpaquePass() )
+	{
+		const float z = -getLayerDepth( _geom->getPlacedKey().depth );
+		for( unsigned int i = start; i < _vlist.size; ++i ) _vlist.storage[i].position.setZ( z );
+	}
+
+	return written;
+}
+
+/*!
+	Vertex submission routine.
+	Sends data to opengl
+*/
+void BatchRenderer::submitVertexList( VertexBatch& vlist, unsigned int type ){
+	if( vlist.empty() ) return;
+
+    glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), &vlist.storage[0].tcoords);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), &vlist.storage[0].color);
+    glVertexPointer(3, GL_FLOAT, sizeof(Vertex), &vlist.storage[0].position);
+
+	glDrawArrays( type, 0, vlist.size );
+
+    //clear the vlist, keeping the storage
+	vlist.size = 0;
+}
+
+/* Immediate drawing routine, fairly simple */
+void BatchRenderer::drawImmediately(  boost::intrusive_ptr<BatchGeometry> geom ){
+
+	if( !geom ) return;
+
+	//If we have a render target active, set it. Don't keep drawing if it failed.
+	if( target && !target->start() ) return;
+
+	// View.
+    view.activate();
+
+	// matrix stuff
+	GLState::matrixMode( GL_MODELVIEW );
+	glPushMatrix();
+
+    // Enable states (they're left on, so this only costs anything the first time)
+    GLState::setClientState(GL_TEXTURE_COORD_ARRAY, true);
+    GLState::setClientState(GL_COLOR_ARRAY, true);
+    GLState::setClientState(GL_VERTEX_ARRAY, true);
+
+	//activate the group state
+	GROUPSTATEMAP::iterator gs = groupstates.find( geom->getGroup() );
+	if( gs != groupstates.end() ) gs->second->begin( *this );
+
+	//set our texture
+	if( (geom->getTextureId()) ){
+		GLState::enable( GL_TEXTURE_2D );
+		geom->getTexture()->bind();
+	}
+	else{
+		GLState::disable( GL_TEXTURE_2D );
+	}
+
+	// Check for clipping, and if clipped, skip regular rendering.
+	bool clipping = false;
+	Rectangle clipping_rect;
+	if( !clipGeometry( geom, clipping, clipping_rect ) ){
+		batchInto( geom.get(), clip_vlist, false );
+		submitVertexList(clip_vlist,geom->getPrimitiveType());
+	} else {
+		//disable clipping
+		GLState::disable( GL_SCISSOR_TEST );
+	}
+
+
+	// call the end group function
+	if( gs != groupstates.end() ) gs->second->end( *this );
+
+	//matrix
+	glPopMatrix();
+
+	//If we have a render target active, and it was in use, unbind it now.
+	if( target ){
+		target->end();
+	}
 }
\ No newline at end of file
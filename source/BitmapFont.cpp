@@ -1,226 +1,288 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-#include <algorithm>
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
-#include "BitmapFont.h"
-#include "BMFontLoader.h"
-
-using namespace phoenix;
-using namespace std;
-using namespace boost;
-
-/*
-	Easy constructor
-*/
-BitmapFont::BitmapFont( RenderSystem& _r, std::string _fnt )
-	: Font( _r, 3), pages(), characters(256), kernings(), line_height(16.0f), spacing( 10.0f ), line_widths()
-{
-	std::fill( characters.begin(), characters.end(), BitmapFont::Character() );
-	load( _r, _fnt );
-}
-
-
-/*
-	Loading routine
-*/
-void BitmapFont::load( RenderSystem& _r, std::string _fnt ){
-	if( _fnt == "" ) return;
-
-	BMFontLoader ldr(_r, this);
-	ldr.load(_fnt);
-}
-
-/*
-	Dimensions calculation
-*/
-const Vector2d BitmapFont::getTextDimensions( const std::string& _s, const Vector2d& _scale )
-{
-	// Set up variables
-	line_widths.clear();
-	Vector2d old_scale = scale;
-	if( _scale != Vector2d(0,0) ) scale = _scale;
-    float culmative_x = 0.0f;
-	float culmative_y = 0.0f;
-	float max_x = 0.0f;
-
-    //Iterate over each character, calculating size
-    for( unsigned int i = 0; i < _s.size(); ++i)
-    {
-
-		const unsigned char glyph = _s[i];
-
-		if( glyph == '\n' ){
-			culmative_y += line_height * scale.getY();
-			max_x = max( max_x, culmative_x );
-			line_widths.push_back(culmative_x);
-			culmative_x = 0;
-			continue;
-		}
-
-		Character c = characters[glyph];
-
-		float x = culmative_x + ( c.xoffset * scale.getX() );
-		float y = culmative_y + c.yoffset * scale.getY();
-		float w = c.width * scale.getX();
-		float h = c.height * scale.getY();
-
-		//adjust culmative x value
-		float x_inc = (float) c.xadvance;
-		if( i < _s.size()-1 ){
-			x_inc += (float) getKerning( glyph, _s[i+1] );
-		}
-		culmative_x += x_inc * scale.getX();
-    }
-
-	//account for the last line/only line
-	line_widths.push_back(culmative_x);
-	max_x = max( max_x, culmative_x );
-
-	//Add one line of height. We do this because we want the total height and the culmative y is (at this point) the y at the *top* of the last line.
-	culmative_y += line_height * scale.getY();
-
-	//reset state
-	scale = old_scale;
-
-	return Vector2d(max_x,culmative_y);
-}
-
-/*
-	Text drawing routine
-*/
-BatchGeometryPtr BitmapFont::drawText( const string& s, const Vector2d& p, const Color& _c, const Vector2d& _scale, E_TEXT_ALIGNMENT _align )
-{
-
-	// setup pages
-	unsigned int page_count = pages.size();
-	std::vector<BatchGeometryPtr> geoms;
-
-	// return empty geom if we can't draw
-	if( ! getTexture() || page_count == 0 ){
-		return new BatchGeometry( *renderer, GL_QUADS, getTexture(), getGroup(), getDepth() );
-	}
-
-	// build a geom for each page.
-	for( unsigned int i = 0; i < page_count; i++ ){
-		BatchGeometryPtr geom = new BatchGeometry( *renderer, GL_QUADS, pages[i], getGroup(), getDepth() );
-		geom->setImmediate( true );
-		geoms.push_back( geom );
-	}
-
-	// Set up variables
-	Vector2d old_scale = scale;
-	if( _scale != Vector2d(0,0) ) scale = _scale;
-	unsigned int line_no = 0;
-    float culmative_x = 0;
-	float culmative_y = 0;
-	float tw = (float)getTexture()->getWidth();
-	float th = (float)getTexture()->getHeight();
-	float max_line_width = getTextDimensions( s, scale ).getX();
-	std::vector<float> _line_widths = line_widths;
-	BatchGeometryPtr geom = geoms[0];
-
-	// Split the string into individual lines, 
-	// We could just iterate over the string but having the entire line available lets us do alignment
-	typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
-	boost::char_separator<char> sep("\n");
-	tokenizer lines(s, sep);
-
-    //Now for the fun part.
-	for (tokenizer::iterator t_it = lines.begin(); t_it != lines.end(); ++t_it, ++line_no) {
-
-		//locals
-		string line = *t_it;
-		float align_x_offset = 0.0f;
-
-		// Calculate offsets for alignments
-		if( _align == T_ALIGN_CENTER ){
-			align_x_offset = (max_line_width/2.0f) - (_line_widths[line_no]/2.0f);
-		}
-		if( _align == T_ALIGN_RIGHT ){
-			align_x_offset = max_line_width - _line_widths[line_no];
-		}
-
-		//if not the first line, add height.
-		if( t_it != lines.begin() ){
-			culmative_y += line_height * scale.getY();
-			culmative_x = 0;
-		}
-
-		// draw each character.
-		for( unsigned int i = 0; i < line.size(); ++i)
-		{
-
-			const unsigned char glyph = line[i];
-
-			Character c = characters[glyph];
-
-			// get the geom for the active page.
-			geom = geoms[c.page];
-
-			// calculate stuff
-			float u = c.x/tw;
-			float v = c.y/th;
-			float u2 = (c.x + c.width) / tw;
-			float v2 = (c.y + c.height) / th;
-			float x = align_x_offset + culmative_x + ( c.xoffset * scale.getX() );
-			float y = culmative_y + c.yoffset * scale.getY();
-			float w = c.width * scale.getX();
-			float h = c.height * scale.getY();
-
-			//adjust culmative x value
-			float x_inc = (float) c.xadvance;
-			if( i < s.size()-1 ){
-				x_inc += (float) getKerning( glyph, s[i+1] );
-			}
-			culmative_x += x_inc * scale.getX();
-
-			// Top Left Vertex.
-			geom->addVertex( Vertex(
-				Vector2d( x, y ), 
-				color, 
-				TextureCoords( u, v) 
-				));
-			// Top Right
-			geom->addVertex( Vertex(
-				Vector2d( x+w, y ), 
-				color, 
-				TextureCoords( u2, v ) 
-				));
-			// Bottom Right
-			geom->addVertex( Vertex(
-				Vector2d( x+w, y+h ), 
-				color, 
-				TextureCoords( u2, v2 ) 
-				));
-			// Bottom Left
-			geom->addVertex( Vertex(
-				Vector2d( x, y+h ), 
-				color,
-				TextureCoords( u, v2 ) 
-				));
-		}
-	}
-
-	//Create a composite
-	BatchGeometryCompositePtr geom_composite = new BatchGeometryComposite( *renderer );
-	geom_composite->setImmediate( true );
-	geom_composite->getChildren() = geoms;
-
-
-	//Translate, colorize the composite, and return it.
-	geom_composite->translate( p );
-	geom_composite->colorize( _c );
-
-	//reset state
-	scale = old_scale;
-
-	return geom_composite;
-}
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <algorithm>
+#include <boost/algorithm/string.hpp>
+#include "BitmapFont.h"
+#include "BMFontLoader.h"
+#include "DistanceField.h"
+#include "ShaderGroupState.h"
+
+using namespace phoenix;
+using namespace std;
+using namespace boost;
+
+/*
+	Easy constructor
+*/
+BitmapFont::BitmapFont( RenderSystem& _r, std::string _fnt )
+	: Font( _r, 3), pages(), characters(256), blocks(), kernings(), kerning_sorted(true), line_height(16.0f), spacing( 10.0f ), distance_field(false), line_widths(), text_codepoints(), text_placements()
+{
+	std::fill( characters.begin(), characters.end(), BitmapFont::Character() );
+	load( _r, _fnt );
+}
+
+
+/*
+	Loading routine
+*/
+void BitmapFont::load( RenderSystem& _r, std::string _fnt ){
+	if( _fnt == "" ) return;
+
+	BMFontLoader ldr(_r, this);
+	ldr.load(_fnt);
+}
+
+/*
+	Glyph table
+*/
+void BitmapFont::setCharacterProperties( int _ix, const BitmapFont::Character& _c ){
+	if( _ix < 0 || _ix > 0x10FFFF ) return;
+
+	if( _ix < 256 ){
+		characters[_ix] = _c;
+		return;
+	}
+
+	const unsigned int block = ((unsigned int) _ix) >> 8;
+	if( blocks.size() <= block ) blocks.resize( block + 1, 0 );
+	if( blocks[block] == 0 ){
+		blocks[block] = characters.size();
+		characters.resize( characters.size() + 256, BitmapFont::Character() );
+	}
+	characters[ blocks[block] + (_ix & 0xff) ] = _c;
+}
+
+/*
+	Kerning table
+*/
+void BitmapFont::buildKerning(){
+	if( kerning_sorted ) return;
+
+	// Stable, so duplicates stay in the order they were set.
+	std::stable_sort( kernings.begin(), kernings.end() );
+
+	// Keep the last of each run of duplicates.
+	std::vector< KerningPair >::iterator out = kernings.begin();
+	for( std::vector< KerningPair >::iterator it = kernings.begin(); it != kernings.end(); ++it ){
+		if( out != kernings.begin() && (out-1)->first == it->first && (out-1)->second == it->second ){
+			*(out-1) = *it;
+		} else {
+			*out++ = *it;
+		}
+	}
+	kernings.erase( out, kernings.end() );
+
+	kerning_sorted = true;
+}
+
+/*
+	Distance field conversion
+*/
+bool BitmapFont::makeDistanceField( signed int _group, float _spread, unsigned int _threads ){
+	DistanceFieldGenerator generator( _spread, _threads );
+
+	if( ! distance_field ){
+		for( unsigned int i = 0; i < pages.size(); ++i ){
+			if( ! pages[i] ) continue;
+			TexturePtr field = generator.generate( pages[i] );
+			if( ! field ) continue;
+
+			// The font lets go of the bitmap page, it isn't dropped since other fonts can share it.
+			setPage( i, field );
+		}
+		distance_field = true;
+	}
+
+	setGroup( _group );
+
+	ShaderPtr shader;
+	if( ! renderer->getGroupState( _group ) ){
+		shader = DistanceFieldGenerator::createShader( getResourceManager() );
+		renderer->addGroupState( _group, ShaderGroupStatePtr( new ShaderGroupState( shader ) ) );
+	} else {
+		ShaderGroupStatePtr state = boost::dynamic_pointer_cast< ShaderGroupState >( renderer->getGroupState( _group ) );
+		if( state ) shader = state->getShader();
+	}
+
+	return shader && shader->ready();
+}
+
+/*
+	Dimensions calculation
+*/
+const Vector2d BitmapFont::getTextDimensions( const std::string& _s, const Vector2d& _scale )
+{
+	// Set up variables
+	line_widths.clear();
+	Vector2d old_scale = scale;
+	if( _scale != Vector2d(0,0) ) scale = _scale;
+    float culmative_x = 0.0f;
+	float culmative_y = 0.0f;
+	float max_x = 0.0f;
+
+    //Iterate over each character, calculating size
+	const char* it = _s.data();
+	const char* end = it + _s.size();
+	unsigned int next = it != end ? decodeUtf8( it, end ) : 0;
+    for( bool more = ! _s.empty(); more; )
+    {
+		// The next character is decoded ahead, it's needed for kerning.
+		const unsigned int glyph = next;
+		more = it != end;
+		if( more ) next = decodeUtf8( it, end );
+
+		if( glyph == '\n' ){
+			culmative_y += line_height * scale.getY();
+			max_x = max( max_x, culmative_x );
+			line_widths.push_back(culmative_x);
+			culmative_x = 0;
+			continue;
+		}
+
+		//adjust culmative x value
+		float x_inc = (float) getCharacter( glyph ).xadvance;
+		if( more ){
+			x_inc += (float) getKerning( glyph, next );
+		}
+		culmative_x += x_inc * scale.getX();
+    }
+
+	//account for the last line/only line
+	line_widths.push_back(culmative_x);
+	max_x = max( max_x, culmative_x );
+
+	//Add one line of height. We do this because we want the total height and the culmative y is (at this point) the y at the *top* of the last line.
+	culmative_y += line_height * scale.getY();
+
+	//reset state
+	scale = old_scale;
+
+	return Vector2d(max_x,culmative_y);
+}
+
+/*
+	Text drawing routine, single page fonts are written straight into one piece
+	of the renderer's immediate arena. Text in fonts with more pages needs a
+	geometry for each page, so it's drawn with an immediate TextGeometry that
+	holds them together.
+*/
+BatchGeometryPtr BitmapFont::drawText( const string& s, const Vector2d& p, const Color& _c, const Vector2d& _scale, E_TEXT_ALIGNMENT _align )
+{
+	// return empty geom if we can't draw
+	if( ! getTexture() || pages.empty() ){
+		return renderer->createImmediate( GL_QUADS, getTexture(), getGroup(), getDepth() );
+	}
+
+	if( pages.size() > 1 ){
+		return new TextGeometry( this, s, p, _c, _scale, _align, true );
+	}
+
+	const Vector2d text_scale = _scale != Vector2d(0,0) ? _scale : scale;
+	decodeText( s, text_codepoints );
+	const Vector2d dimensions = layoutText( text_codepoints, text_scale, text_placements, line_widths );
+
+	BatchGeometryPtr geom = renderer->createImmediate( GL_QUADS, pages[0], getGroup(), getDepth() );
+	writeText( text_codepoints, text_placements, line_widths, dimensions.getX(), p, _c, text_scale, _align, &geom, 1 );
+
+	return geom;
+}
+
+/*
+	Text layout
+*/
+void BitmapFont::decodeText( const std::string& _s, std::vector< unsigned int >& _out )
+{
+	_out.clear();
+	const char* it = _s.data();
+	const char* end = it + _s.size();
+	while( it != end ) _out.push_back( decodeUtf8( it, end ) );
+}
+
+Vector2d BitmapFont::layoutText( const std::vector< unsigned int >& _cp, const Vector2d& _scale, std::vector< Placement >& _placements, std::vector< float >& _line_widths ) const
+{
+	const unsigned int len = _cp.size();
+	const float scaled_line_height = line_height * _scale.getY();
+	_placements.resize( len );
+	_line_widths.clear();
+
+	float pen_x = 0.0f, pen_y = 0.0f;
+	for( unsigned int i = 0; i < len; ++i )
+	{
+		Placement& pl = _placements[i];
+		pl.pen_x = pen_x;
+		pl.pen_y = pen_y;
+		pl.line = _line_widths.size();
+		pl.vertex = 0;
+
+		if( _cp[i] == '\n' )
+		{
+			pl.page = NO_PAGE;
+			_line_widths.push_back( pen_x );
+			pen_x = 0.0f;
+			pen_y += scaled_line_height;
+			continue;
+		}
+
+		pl.page = getCharacter( _cp[i] ).page;
+		if( pl.page >= pages.size() ) pl.page = NO_PAGE;
+
+		pen_x += getAdvance( _cp, i, _scale );
+	}
+	_line_widths.push_back( pen_x );
+
+	return Vector2d( *std::max_element( _line_widths.begin(), _line_widths.end() ), pen_y + scaled_line_height );
+}
+
+void BitmapFont::writeText( const std::vector< unsigned int >& _cp, std::vector< Placement >& _placements, const std::vector< float >& _line_widths, float _width,
+	const Vector2d& _p, const Color& _c, const Vector2d& _scale, E_TEXT_ALIGNMENT _align, const BatchGeometryPtr* _pages, unsigned int _page_count ) const
+{
+	Vertex quad[4];
+	for( unsigned int i = 0; i < _cp.size(); ++i )
+	{
+		Placement& pl = _placements[i];
+		if( pl.page == NO_PAGE || pl.page >= _page_count ) continue;
+
+		BatchGeometry& geom = *_pages[ pl.page ];
+		pl.vertex = geom.getVertexCount();
+		glyphQuad( _cp[i], pl, _p, getAlignmentOffset( _align, _width, _line_widths[ pl.line ] ), _c, _scale, quad );
+		for( unsigned int v = 0; v < 4; ++v ) geom.addVertex( quad[v] );
+	}
+}
+
+void BitmapFont::glyphQuad( unsigned int _cp, const Placement& _pl, const Vector2d& _p, float _x_offset, const Color& _c, const Vector2d& _scale, Vertex* _out ) const
+{
+	const Character& c = getCharacter( _cp );
+
+	// All pages are the same size.
+	const float tw = (float) pages[0]->getWidth();
+	const float th = (float) pages[0]->getHeight();
+
+	const float u = c.x/tw;
+	const float v = c.y/th;
+	const float u2 = (c.x + c.width) / tw;
+	const float v2 = (c.y + c.height) / th;
+	const float x = _p.getX() + _x_offset + _pl.pen_x + ( c.xoffset * _scale.getX() );
+	const float y = _p.getY() + _pl.pen_y + ( c.yoffset * _scale.getY() );
+	const float w = c.width * _scale.getX();
+	const float h = c.height * _scale.getY();
+
+	_out[0] = Vertex( Vector2d( x, y ), _c, TextureCoords( u, v ) );
+	_out[1] = Vertex( Vector2d( x+w, y ), _c, TextureCoords( u2, v ) );
+	_out[2] = Vertex( Vector2d( x+w, y+h ), _c, TextureCoords( u2, v2 ) );
+	_out[3] = Vertex( Vector2d( x, y+h ), _c, TextureCoords( u, v2 ) );
+}
+
+/*
+	Retained text
+*/
+TextGeometryPtr BitmapFont::createText( const string& _s, const Vector2d& _p, const Color& _c, const Vector2d& _scale, E_TEXT_ALIGNMENT _align )
+{
+	return new TextGeometry( this, _s, _p, _c, _scale, _align, false );
+}
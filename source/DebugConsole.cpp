@@ -1,113 +1,219 @@
-#include "DebugConsole.h"
-#include "BitmapFont.h"
-
-#include <iostream>
-
-using namespace phoenix;
-
-//! Constructor
-DebugConsole::DebugConsole( RenderSystem& _r )
-	: GraphicsFactory2d( _r.getBatchRenderer() ), font( _r.getFont() ), enabled( false ), lines(), linelimit(0), backcolor(0,0,0,200), fontcolor(255,201,201)
-{
-	event_connection = WindowManager::Instance()->listen( boost::bind( &DebugConsole::onWindowEvent, this, _1 ) );
-    setDepth( 999.0f );
-    setGroup( -10 );
-	 _r.getBatchRenderer().addGroupState( -10, GroupStatePtr( new ConsoleGroupState() ) );
-    updateLineLimit();
-}
-
-//! Listens for Window Events ( To Open/Close the console ).
-void DebugConsole::onWindowEvent( const WindowEvent& e )
-{
-	switch( e.type ){
-		case WET_KEY:
-			if( e.bool_data == true && e.int_data == PHK_BACKTICK ){
-				enabled = !enabled;
-			}
-			break;
-		case WET_RESIZE:
-			updateLineLimit();
-			break;
-		default:
-			break;
-	}
-}
-
-/*
-	Write String
-*/
-void DebugConsole::write( std::string _s )
-{
-    //stream and temporary storage.
-    std::istringstream stream( _s );        
-    char temp[256];
-
-    // The first line in the string, even if it's empty, will be added to the current line.
-    if( ! lines.empty() )
-    {
-        stream.getline( temp, 256 );
-        lines.back() += std::string( temp );
-    }
-
-    // The remaining lines in the string will be addeded as completely new lines.
-    for( int i = 0; !stream.eof(); ++i )
-    {
-        stream.getline( temp, 256 );
-        lines.push_back( std::string( temp ) );
-    }
-
-    // Limit the number of lines.
-    limitLines();
-}
-
-
-/*
-	Draw the console
-*/
-void DebugConsole::draw( )
-{
-    if( enabled )
-    {
-		// we want the font's line height to be 16, so adjust the scale accordingly
-		float scale = 1.0f;
-		
-		if( font->getType() == ERT_BITMAP_FONT ) {
-			BitmapFontPtr bmfont = boost::dynamic_pointer_cast<BitmapFont>(font);
-			scale = 1.0f/( bmfont->getLineHeight()/20.0f );
-		}
-
-        // Draw our overlay rectangle at depth- 0.01;
-        BatchGeometryPtr geom = drawRectangle( Rectangle( Vector2d(0,0), (WindowManager::Instance())->getWindowSize() ), backcolor, backcolor, backcolor, backcolor);
-        setDepth( getDepth() - 0.01f );
-        apply( geom );
-        setDepth( getDepth() + 0.01f );
-        
-		//output the text
-		std::string output;
-		output += std::string("-= ") + std::string( PHOENIXCORE_VERSION ) + std::string(" Debug Console =-");
-
-        unsigned int count = 1;
-        for( std::deque< std::string >::iterator i = lines.begin(); i != lines.end(); ++i, ++count )
-        {
-            output += "\n" + *i;
-        }
-
-		geom = font->drawText( output, Vector2d( 8.0f, 8.0f ), fontcolor, Vector2d(scale,scale) );
-		apply( geom, EFF_ALL - EFF_TEXTURE );
-    }
-}
-
-/*
-	Group Begin ( sets view ).
-*/
-void DebugConsole::ConsoleGroupState::begin( BatchRenderer& r ){
-    View view;
-    view.activate();
-}
-
-/*
-	Group End (restores view).
-*/
-void DebugConsole::ConsoleGroupState::end( BatchRenderer& r ){
-    r.getView().activate();
+#include "DebugConsole.h"
+#include "BitmapFont.h"
+
+#include <iostream>
+
+using namespace phoenix;
+
+//! Constructor
+DebugConsole::DebugConsole( RenderSystem& _r )
+	: GraphicsFactory2d( _r.getBatchRenderer() ), font( _r.getFont() ), enabled( false ), ring(), head(0), count(0), background(), header(), shown(false), changed(true), layout_count(0),
+	linelimit(0), backcolor(0,0,0,200), fontcolor(255,201,201)
+{
+	event_connection = WindowManager::Instance()->listen( boost::bind( &DebugConsole::onWindowEvent, this, _1 ) );
+    setDepth( 999.0f );
+    setGroup( -10 );
+	 _r.getBatchRenderer().addGroupState( -10, GroupStatePtr( new ConsoleGroupState() ) );
+    setCapacity();
+    updateLineLimit();
+}
+
+//! Listens for Window Events ( To Open/Close the console ).
+void DebugConsole::onWindowEvent( const WindowEvent& e )
+{
+	switch( e.type ){
+		case WET_KEY:
+			if( e.bool_data == true && e.int_data == PHK_BACKTICK ){
+				enabled = !enabled;
+			}
+			break;
+		case WET_RESIZE:
+			updateLineLimit();
+			release( background );
+			changed = true;
+			break;
+		default:
+			break;
+	}
+}
+
+/*
+	Ring buffer
+*/
+void DebugConsole::setCapacity( unsigned int _c )
+{
+	if( _c == 0 ) _c = 1;
+
+	// Unroll the ring, keeping the newest lines.
+	while( count > _c ) evict();
+	std::vector< Line > unrolled( _c );
+	for( unsigned int i = 0; i < count; ++i )
+	{
+		unrolled[i].text.swap( line(i).text );
+		unrolled[i].geom = line(i).geom;
+		unrolled[i].row = line(i).row;
+	}
+
+	ring.swap( unrolled );
+	head = 0;
+	changed = true;
+}
+
+DebugConsole::Line& DebugConsole::push()
+{
+	if( count == ring.size() ) evict();
+
+	Line& l = line( count++ );
+	l.text.clear();
+	l.row = 0;
+	return l;
+}
+
+void DebugConsole::evict()
+{
+	if( count == 0 ) return;
+
+	Line& l = line(0);
+	l.text.clear();
+	release( l.geom );
+	head = ( head + 1 ) % ring.size();
+	--count;
+	changed = true;
+}
+
+/*
+	Write String
+*/
+void DebugConsole::write( std::string _s )
+{
+	std::string::size_type start = 0, end = _s.find( '\n' );
+
+    // The first line in the string, even if it's empty, will be added to the current line.
+	Line& last = count ? line( count-1 ) : push();
+	if( end != start )
+	{
+		last.text.append( _s, start, end == std::string::npos ? std::string::npos : end - start );
+		release( last.geom );
+	}
+
+    // The remaining lines in the string will be added as completely new lines.
+	while( end != std::string::npos )
+	{
+		start = end + 1;
+		end = _s.find( '\n', start );
+		push().text.assign( _s, start, end == std::string::npos ? std::string::npos : end - start );
+	}
+
+	changed = true;
+}
+
+/*
+	Visibility
+*/
+void DebugConsole::show( bool _s )
+{
+	if( background ) background->setEnabled( _s );
+	if( header ) header->setEnabled( _s );
+	for( unsigned int i = 0; i < count; ++i )
+	{
+		if( line(i).geom ) line(i).geom->setEnabled( _s );
+	}
+	shown = _s;
+}
+
+void DebugConsole::invalidate()
+{
+	release( background );
+	release( header );
+	for( unsigned int i = 0; i < count; ++i )
+	{
+		release( line(i).geom );
+	}
+	changed = true;
+}
+
+/*
+	Draw the console
+*/
+void DebugConsole::draw( )
+{
+	if( ! enabled )
+	{
+		if( shown ) show( false );
+		return;
+	}
+
+	if( shown && ! changed ) return;
+	if( ! shown ) show( true );
+
+	// we want the font's line height to be 20, so adjust the scale accordingly
+	float scale = 1.0f;
+	if( font->getType() == ERT_BITMAP_FONT ) {
+		BitmapFontPtr bmfont = boost::dynamic_pointer_cast<BitmapFont>(font);
+		scale = 1.0f/( bmfont->getLineHeight()/20.0f );
+	}
+
+	if( ! background )
+	{
+		// Draw our overlay rectangle at depth- 0.01;
+		background = drawRectangle( Rectangle( Vector2d(0,0), (WindowManager::Instance())->getWindowSize() ), backcolor, backcolor, backcolor, backcolor);
+		background->setImmediate( false );
+		setDepth( getDepth() - 0.01f );
+		apply( background );
+		setDepth( getDepth() + 0.01f );
+	}
+
+	if( ! header )
+	{
+		header = font->drawText( std::string("-= ") + std::string( PHOENIXCORE_VERSION ) + std::string(" Debug Console =-"), Vector2d( 8.0f, 8.0f ), fontcolor, Vector2d(scale,scale) );
+		header->setImmediate( false );
+		apply( header, EFF_ALL - EFF_TEXTURE );
+	}
+
+	// Lines that scrolled off the top don't need geometry.
+	const unsigned int first = count > linelimit ? count - linelimit : 0;
+	for( unsigned int i = 0; i < first; ++i )
+	{
+		release( line(i).geom );
+	}
+
+	// The rest are laid out if they're new, and moved if they scrolled.
+	for( unsigned int i = first; i < count; ++i )
+	{
+		Line& l = line(i);
+		const unsigned int row = i - first + 1;
+
+		if( l.text.empty() ) continue;
+
+		if( ! l.geom )
+		{
+			l.geom = font->drawText( l.text, Vector2d( 8.0f, 8.0f + 20.0f * row ), fontcolor, Vector2d(scale,scale) );
+			l.geom->setImmediate( false );
+			apply( l.geom, EFF_ALL - EFF_TEXTURE );
+			l.row = row;
+			++layout_count;
+		}
+		else if( l.row != row )
+		{
+			l.geom->translate( Vector2d( 0.0f, 20.0f * ( (float) row - (float) l.row ) ) );
+			l.row = row;
+		}
+	}
+
+	changed = false;
+}
+
+/*
+	Group Begin ( sets view ).
+*/
+void DebugConsole::ConsoleGroupState::begin( BatchRenderer& r ){
+    View view;
+    view.activate();
+}
+
+/*
+	Group End (restores view).
+*/
+void DebugConsole::ConsoleGroupState::end( BatchRenderer& r ){
+    r.getView().activate();
 }
\ No newline at end of file
@@ -0,0 +1,208 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <cmath>
+#include <algorithm>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include "DistanceField.h"
+
+using namespace phoenix;
+
+//! Distance to pixels that aren't there, large but small enough to not overflow when squared sums are taken.
+static const float FAR_AWAY = 1e20f;
+
+/*
+	1D squared euclidean distance transform, from Felzenszwalb and Huttenlocher's
+	"Distance Transforms of Sampled Functions". Finds the lower envelope of the
+	parabolas rooted at each sample, then reads the distances off of it.
+*/
+static void transform( const float* f, unsigned int n, float* d, int* v, float* z )
+{
+	int k = 0;
+	v[0] = 0;
+	z[0] = -FAR_AWAY;
+	z[1] = FAR_AWAY;
+
+	for( int q = 1; q < (int) n; ++q )
+	{
+		float s = ( ( f[q] + q*q ) - ( f[v[k]] + v[k]*v[k] ) ) / ( 2*q - 2*v[k] );
+		while( s <= z[k] )
+		{
+			--k;
+			s = ( ( f[q] + q*q ) - ( f[v[k]] + v[k]*v[k] ) ) / ( 2*q - 2*v[k] );
+		}
+		++k;
+		v[k] = q;
+		z[k] = s;
+		z[k+1] = FAR_AWAY;
+	}
+
+	k = 0;
+	for( int q = 0; q < (int) n; ++q )
+	{
+		while( z[k+1] < q ) ++k;
+		d[q] = (float)( ( q - v[k] ) * ( q - v[k] ) ) + f[v[k]];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Passes
+////////////////////////////////////////////////////////////////////////////////
+
+void DistanceFieldGenerator::columns( std::vector<float>* _grid, unsigned int _w, unsigned int _h, unsigned int _begin, unsigned int _end ) const
+{
+	std::vector<float> f( _h ), d( _h ), z( _h + 1 );
+	std::vector<int> v( _h );
+
+	for( unsigned int g = 0; g < 2; ++g )
+	{
+		float* grid = &_grid[g][0];
+		for( unsigned int x = _begin; x < _end; ++x )
+		{
+			for( unsigned int y = 0; y < _h; ++y ) f[y] = grid[ y*_w + x ];
+			transform( &f[0], _h, &d[0], &v[0], &z[0] );
+			for( unsigned int y = 0; y < _h; ++y ) grid[ y*_w + x ] = d[y];
+		}
+	}
+}
+
+void DistanceFieldGenerator::rows( std::vector<float>* _grid, unsigned int _w, unsigned int /*_h*/, unsigned int _begin, unsigned int _end ) const
+{
+	std::vector<float> d( _w ), z( _w + 1 );
+	std::vector<int> v( _w );
+
+	for( unsigned int g = 0; g < 2; ++g )
+	{
+		for( unsigned int y = _begin; y < _end; ++y )
+		{
+			float* row = &_grid[g][ y*_w ];
+			transform( row, _w, &d[0], &v[0], &z[0] );
+			std::copy( d.begin(), d.end(), row );
+		}
+	}
+}
+
+void DistanceFieldGenerator::parallel( void (DistanceFieldGenerator::*_pass)( std::vector<float>*, unsigned int, unsigned int, unsigned int, unsigned int ) const,
+	std::vector<float>* _grid, unsigned int _w, unsigned int _h, unsigned int _count ) const
+{
+	unsigned int thread_count = threads ? threads : boost::thread::hardware_concurrency();
+	thread_count = std::max( 1u, std::min( thread_count, _count ) );
+
+	if( thread_count == 1 )
+	{
+		(this->*_pass)( _grid, _w, _h, 0, _count );
+		return;
+	}
+
+	boost::thread_group group;
+	for( unsigned int i = 0; i < thread_count; ++i )
+	{
+		const unsigned int begin = ( _count * i ) / thread_count;
+		const unsigned int end = ( _count * (i+1) ) / thread_count;
+		group.create_thread( boost::bind( _pass, this, _grid, _w, _h, begin, end ) );
+	}
+	group.join_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Generation
+////////////////////////////////////////////////////////////////////////////////
+
+void DistanceFieldGenerator::generate( const GLubyte* _src, unsigned int _w, unsigned int _h, GLubyte* _dst ) const
+{
+	if( _w == 0 || _h == 0 ) return;
+
+	// 0 is the squared distance to the nearest inside pixel, 1 to the nearest outside pixel.
+	std::vector<float> grid[2];
+	grid[0].resize( _w*_h );
+	grid[1].resize( _w*_h );
+	for( unsigned int i = 0; i < _w*_h; ++i )
+	{
+		const bool inside = _src[ i*4 + 3 ] >= 128;
+		grid[0][i] = inside ? 0.0f : FAR_AWAY;
+		grid[1][i] = inside ? FAR_AWAY : 0.0f;
+	}
+
+	parallel( &DistanceFieldGenerator::columns, grid, _w, _h, _w );
+	parallel( &DistanceFieldGenerator::rows, grid, _w, _h, _h );
+
+	const float scale = 1.0f / ( 2.0f * spread );
+	for( unsigned int i = 0; i < _w*_h; ++i )
+	{
+		// Distances are between pixel centers, the edge is half way between an inside and an outside pixel.
+		const float distance = grid[0][i] == 0.0f ? std::sqrt( grid[1][i] ) - 0.5f : 0.5f - std::sqrt( grid[0][i] );
+		const float alpha = std::min( 1.0f, std::max( 0.0f, 0.5f + distance * scale ) );
+		_dst[ i*4 ] = _dst[ i*4 + 1 ] = _dst[ i*4 + 2 ] = 255;
+		_dst[ i*4 + 3 ] = (GLubyte)( alpha * 255.0f + 0.5f );
+	}
+}
+
+TexturePtr DistanceFieldGenerator::generate( TexturePtr _t ) const
+{
+	if( ! _t || _t->getWidth() <= 0 || _t->getHeight() <= 0 ) return TexturePtr();
+	if( _t->isEvicted() ) _t->restore();
+
+	const unsigned int w = _t->getWidth(), h = _t->getHeight();
+	std::vector<GLubyte> src( w*h*4 ), dst( w*h*4 );
+
+	GLState::bindTexture( _t->getTextureId( ) );
+	glGetTexImage( GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, &src[0] );
+
+	generate( &src[0], w, h, &dst[0] );
+
+	GLuint id = 0;
+	glGenTextures( 1, &id );
+	GLState::bindTexture( id );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+	glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, &dst[0] );
+
+	TexturePtr field = new Texture( _t->getResourceManager() );
+	field->setTextureId( id );
+	field->setWidth( w );
+	field->setHeight( h );
+	field->setName( _t->getName() + " distance field" );
+	field->queryFormat();
+
+	return field;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Shader
+////////////////////////////////////////////////////////////////////////////////
+
+ShaderPtr DistanceFieldGenerator::createShader( ResourceManager& _r )
+{
+	static const char* vertex =
+		"#version 120\n"
+		"void main (void)\n"
+		"{\n"
+		"	gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;\n"
+		"	gl_TexCoord[0] = gl_MultiTexCoord0;\n"
+		"	gl_FrontColor = gl_Color;\n"
+		"}\n";
+
+	// fwidth() is how much the distance changes over a screen pixel, so the edge stays about a pixel wide at any scale.
+	static const char* fragment =
+		"#version 120\n"
+		"uniform sampler2D tex;\n"
+		"void main (void)\n"
+		"{\n"
+		"	float distance = texture2D( tex, gl_TexCoord[0].st ).a;\n"
+		"	float width = clamp( fwidth( distance ) * 0.75, 0.001, 0.5 );\n"
+		"	float alpha = smoothstep( 0.5 - width, 0.5 + width, distance );\n"
+		"	gl_FragColor = vec4( gl_Color.rgb, gl_Color.a * alpha );\n"
+		"}\n";
+
+	ShaderPtr shader = new Shader( _r );
+	shader->setName( "Distance field shader" );
+	shader->loadFromString( vertex, fragment );
+	return shader;
+}
@@ -0,0 +1,103 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include "GLState.h"
+
+using namespace phoenix;
+
+boost::unordered_map< GLenum, bool > GLState::enabled;
+boost::unordered_map< GLenum, bool > GLState::client_states;
+
+GLuint GLState::textures[ GLState::TEXTURE_UNITS ] = { 0 };
+bool GLState::textures_known[ GLState::TEXTURE_UNITS ] = { false };
+unsigned int GLState::active_unit = 0;
+bool GLState::active_unit_known = false;
+
+GLuint GLState::program = 0;
+bool GLState::program_known = false;
+
+GLuint GLState::framebuffer = 0;
+bool GLState::framebuffer_known = false;
+
+GLenum GLState::blend_src = GL_ONE;
+GLenum GLState::blend_dst = GL_ZERO;
+bool GLState::blend_known = false;
+
+GLint GLState::scissor_box[4] = { 0, 0, 0, 0 };
+bool GLState::scissor_known = false;
+
+GLint GLState::viewport_box[4] = { 0, 0, 0, 0 };
+bool GLState::viewport_known = false;
+
+GLenum GLState::matrix_mode = GL_MODELVIEW;
+bool GLState::matrix_mode_known = false;
+
+GLfloat GLState::modelview[16] = { 0 };
+bool GLState::modelview_known = false;
+
+unsigned int GLState::calls = 0;
+unsigned int GLState::filtered = 0;
+
+/*!
+	OpenGL unbinds a texture from every unit when it's deleted.
+*/
+void GLState::forgetTexture( const GLuint _texture )
+{
+	for( unsigned int i = 0; i < TEXTURE_UNITS; ++i )
+	{
+		if( textures[i] == _texture ) textures_known[i] = false;
+	}
+}
+
+void GLState::forgetTextures()
+{
+	for( unsigned int i = 0; i < TEXTURE_UNITS; ++i ) textures_known[i] = false;
+	active_unit_known = false;
+}
+
+/*!
+	A program that's deleted while it's in use stays in use until another is made current, but its id
+	can be handed out again, so it's forgotten rather than assumed to be unbound.
+*/
+void GLState::forgetProgram( const GLuint _program )
+{
+	if( program == _program ) program_known = false;
+}
+
+/*!
+	OpenGL binds the window again when the bound framebuffer is deleted.
+*/
+void GLState::forgetFramebuffer( const GLuint _fbo )
+{
+	if( framebuffer == _fbo ) framebuffer_known = false;
+}
+
+const GLint* GLState::getViewport()
+{
+	if( ! viewport_known )
+	{
+		glGetIntegerv( GL_VIEWPORT, viewport_box );
+		viewport_known = true;
+	}
+	return viewport_box;
+}
+
+void GLState::invalidate()
+{
+	enabled.clear();
+	client_states.clear();
+	forgetTextures();
+	program_known = false;
+	framebuffer_known = false;
+	blend_known = false;
+	scissor_known = false;
+	viewport_known = false;
+	matrix_mode_known = false;
+	modelview_known = false;
+}
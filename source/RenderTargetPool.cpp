@@ -0,0 +1,125 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include "RenderTargetPool.h"
+
+using namespace phoenix;
+
+/*!
+	The texture's storage is allocated without being filled in, whatever was drawn to a reused target
+	last is still there, so passes should clear it (or draw over all of it) first.
+*/
+RenderTargetPtr RenderTargetPool::acquire( const Vector2d& _size, GLenum _format )
+{
+	const Key key( (int)_size.getX(), (int)_size.getY(), _format );
+	FREEMAP::iterator it = free_targets.find( key );
+	if( it != free_targets.end() )
+	{
+		while( ! it->second.empty() )
+		{
+			RenderTargetPtr target = it->second.back().target;
+			it->second.pop_back();
+			--free_count;
+
+			// Dropped while it was in the pool.
+			if( target->dropped() )
+			{
+				drop( target );
+				continue;
+			}
+
+			slots.find( target.get() )->second.free = false;
+			++reuses;
+			return target;
+		}
+	}
+
+	RenderTargetPtr target = new RenderTarget( rmanager );
+	TexturePtr texture = new Texture( rmanager );
+	texture->allocate( _size, _format );
+	target->attach( texture );
+	slots.insert( std::make_pair( target.get(), Slot( target, key ) ) );
+	++allocations;
+	return target;
+}
+
+void RenderTargetPool::release( RenderTargetPtr _target )
+{
+	SLOTMAP::iterator it = slots.find( _target.get() );
+	if( it == slots.end() || it->second.free ) return;
+
+	if( _target->dropped() )
+	{
+		drop( _target );
+		return;
+	}
+
+	// Kept by what was asked for, the internal format OpenGL gives back may be different.
+	it->second.free = true;
+	free_targets[ it->second.key ].push_back( Entry( _target, rmanager.getFrame() ) );
+	++free_count;
+}
+
+void RenderTargetPool::trim( unsigned int _frames )
+{
+	const unsigned int frame = rmanager.getFrame();
+	for( FREEMAP::iterator it = free_targets.begin(); it != free_targets.end(); ++it )
+	{
+		std::vector< Entry >& entries = it->second;
+		std::vector< Entry >::iterator keep = entries.begin();
+		for( std::vector< Entry >::iterator e = entries.begin(); e != entries.end(); ++e )
+		{
+			if( frame - e->frame >= _frames || e->target->dropped() )
+			{
+				drop( e->target );
+				--free_count;
+			}
+			else
+			{
+				*keep++ = *e;
+			}
+		}
+		entries.erase( keep, entries.end() );
+	}
+
+	forgetDropped();
+}
+
+void RenderTargetPool::clear()
+{
+	for( FREEMAP::iterator it = free_targets.begin(); it != free_targets.end(); ++it )
+	{
+		for( std::vector< Entry >::iterator e = it->second.begin(); e != it->second.end(); ++e )
+		{
+			drop( e->target );
+		}
+	}
+	free_targets.clear();
+	free_count = 0;
+
+	forgetDropped();
+}
+
+void RenderTargetPool::drop( RenderTargetPtr _target )
+{
+	slots.erase( _target.get() );
+	if( _target->getTexture() ) _target->getTexture()->drop();
+	_target->drop();
+}
+
+void RenderTargetPool::forgetDropped()
+{
+	for( SLOTMAP::iterator it = slots.begin(); it != slots.end(); )
+	{
+		SLOTMAP::iterator next = it;
+		++next;
+		if( ! it->second.free && it->second.target->dropped() ) drop( it->second.target );
+		it = next;
+	}
+}
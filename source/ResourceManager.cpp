@@ -1,74 +1,129 @@
-/*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-#include "ResourceManager.h"
-
-#include <boost/date_time/posix_time/posix_time.hpp>
-#include <boost/thread/thread.hpp>
-
-using namespace phoenix;
-
-/*!---------------------
-Clear
------------------------*/
-
-void phoenix::ResourceManager::clear( bool drop  )
-{
-	boost::recursive_mutex::scoped_lock l( getMutex()  );
-	if( drop ){
-		for( std::list< boost::intrusive_ptr<phoenix::Resource> >::iterator i = resourcelist.begin(); i != resourcelist.end(); ++i )
-		{
-			if( *i ) (*i)->drop();
-		}
-	}
-	recyclelist.clear();
-    resourcelist.clear();
-}
-
-/*!---------------------
-Find resource
------------------------*/
-boost::intrusive_ptr<phoenix::Resource> phoenix::ResourceManager::find( const std::string& name )
-{
-	boost::recursive_mutex::scoped_lock( *getMutex() );
-    for( std::list< boost::intrusive_ptr<phoenix::Resource> >::iterator i = resourcelist.begin(); i != resourcelist.end(); ++i )
-    {
-        if( (*i)->getName() == name )
-        {
-            return (*i)->grab<phoenix::Resource>();
-        }
-    }
-    return boost::intrusive_ptr<phoenix::Resource>();
-}
-
-//Garbage collector
-void phoenix::ResourceManager::clean()
-{
-	
-	boost::recursive_mutex::scoped_lock l( getMutex() );
-
-    unsigned int multiplier = recyclelist.size()/getCollectionRate();
-    if( multiplier < getCollectionRate() ) multiplier = getCollectionRate();
-	
-	for( unsigned int i = 0; i < multiplier; ++i )
-	{
-		if( ! recyclelist.empty() )
-		{
-			boost::intrusive_ptr<phoenix::Resource>& g = recyclelist.back();
-			if( g )
-				resourcelist.remove( g );
-			recyclelist.pop_back();
-		}
-		else
-		{
-			break;
-		}
-	}
-
-}
\ No newline at end of file
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include "ResourceManager.h"
+
+#include <algorithm>
+#include <utility>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/thread/thread.hpp>
+
+using namespace phoenix;
+
+/*!---------------------
+Clear
+-----------------------*/
+
+void phoenix::ResourceManager::clear( bool drop  )
+{
+	boost::recursive_mutex::scoped_lock l( getMutex()  );
+	if( drop ){
+		for( std::list< boost::intrusive_ptr<phoenix::Resource> >::iterator i = resourcelist.begin(); i != resourcelist.end(); ++i )
+		{
+			if( *i ) (*i)->drop();
+		}
+	}
+	recyclelist.clear();
+    resourcelist.clear();
+}
+
+/*!---------------------
+Find resource
+-----------------------*/
+boost::intrusive_ptr<phoenix::Resource> phoenix::ResourceManager::find( const std::string& name )
+{
+	boost::recursive_mutex::scoped_lock( *getMutex() );
+    for( std::list< boost::intrusive_ptr<phoenix::Resource> >::iterator i = resourcelist.begin(); i != resourcelist.end(); ++i )
+    {
+        if( (*i)->getName() == name )
+        {
+            return (*i)->grab<phoenix::Resource>();
+        }
+    }
+    return boost::intrusive_ptr<phoenix::Resource>();
+}
+
+//Garbage collector
+void phoenix::ResourceManager::clean()
+{
+	
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+
+    unsigned int multiplier = recyclelist.size()/getCollectionRate();
+    if( multiplier < getCollectionRate() ) multiplier = getCollectionRate();
+	
+	for( unsigned int i = 0; i < multiplier; ++i )
+	{
+		if( ! recyclelist.empty() )
+		{
+			boost::intrusive_ptr<phoenix::Resource>& g = recyclelist.back();
+			if( g )
+				resourcelist.remove( g );
+			recyclelist.pop_back();
+		}
+		else
+		{
+			break;
+		}
+	}
+
+}
+
+/*!---------------------
+Memory budget
+-----------------------*/
+
+void phoenix::ResourceManager::tick()
+{
+	++frame;
+	if( memory_budget ) enforceBudget();
+}
+
+boost::uint64_t phoenix::ResourceManager::getMemoryUsage()
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+	boost::uint64_t total = 0;
+	for( std::list< boost::intrusive_ptr<phoenix::Resource> >::iterator i = resourcelist.begin(); i != resourcelist.end(); ++i )
+	{
+		if( *i && !(*i)->dropped() ) total += (*i)->getMemoryUsage();
+	}
+	return total;
+}
+
+boost::uint64_t phoenix::ResourceManager::enforceBudget()
+{
+	boost::recursive_mutex::scoped_lock l( getMutex() );
+
+	boost::uint64_t usage = getMemoryUsage();
+	if( !memory_budget || usage <= memory_budget ) return 0;
+
+	// Gather everything that's been idle long enough, oldest first.
+	std::vector< std::pair< unsigned int, phoenix::Resource* > > candidates;
+	for( std::list< boost::intrusive_ptr<phoenix::Resource> >::iterator i = resourcelist.begin(); i != resourcelist.end(); ++i )
+	{
+		if( *i && !(*i)->dropped() && (*i)->getMemoryUsage() && frame - (*i)->getLastUsed() > eviction_age )
+		{
+			candidates.push_back( std::make_pair( (*i)->getLastUsed(), (*i).get() ) );
+		}
+	}
+	std::sort( candidates.begin(), candidates.end() );
+
+	boost::uint64_t freed = 0;
+	for( unsigned int i = 0; i < candidates.size() && usage - freed > memory_budget; ++i )
+	{
+		boost::uint64_t size = candidates[i].second->getMemoryUsage();
+		if( candidates[i].second->evict() )
+		{
+			freed += size - candidates[i].second->getMemoryUsage();
+			++evictions;
+		}
+	}
+
+	return freed;
+}
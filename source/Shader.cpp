@@ -1,182 +1,452 @@
-/*
-
-Copyright (c) 2011, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-#include <sstream>
-#include <fstream>
-#include "Shader.h"
-#include "Phoenix.h"
-
-using namespace phoenix;
-
-/* Destructor */
-Shader::~Shader(){
-	if( vertex_shader ) glDeleteShader( vertex_shader );
-	if( fragment_shader ) glDeleteShader( fragment_shader );
-	if( shader_program ) glDeleteProgram( shader_program );
-}
-
-/* Acivates a shader */
-void Shader::activate(){
-	if( !GLEW_VERSION_2_0 ) return;
-	if( shader_program ){
-		glUseProgram(shader_program);
-	} else {
-		glUseProgram( 0 );
-	}
-};
-
-/*! Activates FFP
-*/
-void Shader::deactivate(){
-	if( !GLEW_VERSION_2_0 ) return;
-	glUseProgram( 0 );
-}
-
-/*! Find the location of a uniform in the shader. If not there, returns -1.
-*/
-int Shader::getUniform( const std::string &uniform_name ) {
-    return glGetUniformLocation( shader_program , uniform_name.c_str() );
-}
-
-void Shader::setUniform( const std::string &uniform_name, const int value ) {
-    glUniform1i( getUniform(uniform_name) , value );
-}
-
-void Shader::setUniform( const std::string &uniform_name, const float value ) {
-    glUniform1f( getUniform(uniform_name) , value );
-}
-
-void Shader::setUniform( const std::string &uniform_name, const Vector2d &value ) {
-    glUniform2f( getUniform(uniform_name) , value.getX(), value.getY() );
-}
-
-void Shader::setUniform( const std::string &uniform_name, const Color &value ) {
-    glUniform4f( getUniform(uniform_name) , (GLfloat)value.getRed()/255.0f, (GLfloat)value.getGreen()/255.0f, (GLfloat)value.getBlue()/255.0f, (GLfloat)value.getAlpha()/255.0f );
-}
-
-void Shader::setUniform( const std::string &uniform_name, const TexturePtr value ) {
-    glUniform1i( getUniform(uniform_name) , value->getTextureId() );
-}
-   
-
-/*! Loads shader files, compiles them and links them
-*/
-bool Shader::load( const std::string& vertex_file, const std::string& fragment_file ){
-	vertex_shader = compile( GL_VERTEX_SHADER, getFileContents( vertex_file ) );
-	fragment_shader = compile( GL_FRAGMENT_SHADER, getFileContents( fragment_file ) );
-
-	if( !vertex_shader || ! fragment_shader ) return false;
-
-	shader_program = link();
-
-	if( !shader_program ) return false;
-
-	return true;
-}
-
-/*! Loads shaders from a string, compiles, and links them */
-bool Shader::loadFromString( const std::string& vertex_source, const std::string& fragment_source ){
-	vertex_shader = compile( GL_VERTEX_SHADER, vertex_source );
-	fragment_shader = compile( GL_FRAGMENT_SHADER, fragment_source );
-
-	if( !vertex_shader || ! fragment_shader ) return false;
-
-	shader_program = link();
-
-	if( !shader_program ) return false;
-
-	return true;
-}
-
-/*! Compiles a specific shader, usually not called directly
-*/
-GLuint Shader::compile( GLenum _type, const std::string& _source ){
-	if( !GLEW_VERSION_2_0 ) return 0;
-
-	// create a shader object
-	GLuint shader = glCreateShader(_type);
-
-	// compile it
-	const GLchar* src = _source.c_str();
-	const GLint size = _source.size(); 
-	glShaderSource(shader, 1, &src, &size);
-	glCompileShader(shader);
-
-	//check it
-	GLint shader_ok;
-	glGetShaderiv(shader, GL_COMPILE_STATUS, &shader_ok);
-	if (!shader_ok) {
-		addError("Failed to compile shader object:");
-		show_info_log(shader, glGetShaderiv, glGetShaderInfoLog);
-		glDeleteShader(shader);
-		return 0;
-	}
-
-	return shader;
-}
-
-/*! Links the shader program
-*/
-GLuint Shader::link(){
-	if( !GLEW_VERSION_2_0 ) return 0;
-	GLint program_ok;
-
-	GLuint program = glCreateProgram();
-	glAttachShader(program, vertex_shader);
-	glAttachShader(program, fragment_shader);
-	glLinkProgram(program);
-
-	glGetProgramiv(program, GL_LINK_STATUS, &program_ok);
-	if (!program_ok) {
-		addError("Failed to link shader program:");
-		show_info_log(program, glGetProgramiv, glGetProgramInfoLog);
-		glDeleteProgram(program);
-
-		shader_program = 0;
-		return 0;
-	} else {
-		shader_program = program;
-		return program;
-	}
-}
-
-
-/* Adds a string to the error log */
-void Shader::addError( const std::string& _error ){
-	errors += _error + std::string("\n");
-}
-
-/*! Retrieves errors from OpenGL */
-void Shader::show_info_log(
-	GLuint object,
-	PFNGLGETSHADERIVPROC glGet__iv,
-	PFNGLGETSHADERINFOLOGPROC glGet__InfoLog
-)
-{
-	GLint log_length;
-	char *log;
-
-	glGet__iv(object, GL_INFO_LOG_LENGTH, &log_length);
-	log = (char *)malloc(log_length);
-	glGet__InfoLog(object, log_length, NULL, log);
-	addError(log);
-	free(log);
-}
-
-/* Reads and entire file and returns it as a string */
-const std::string Shader::getFileContents( const std::string& file_name ){
-	std::ifstream file;
-	file.open( file_name.c_str(), std::ios::in );
-
-	if( !file.is_open() || !file.good() ) return std::string("");
-
-	std::stringstream buffer;
-	buffer << file.rdbuf();
-
-	return buffer.str();
+/*
+
+Copyright (c) 2011, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+#include "Shader.h"
+#include "Phoenix.h"
+
+using namespace phoenix;
+
+/* Destructor */
+Shader::~Shader(){
+	if( vertex_shader ) glDeleteShader( vertex_shader );
+	if( fragment_shader ) glDeleteShader( fragment_shader );
+	if( shader_program ){
+		GLState::forgetProgram( shader_program );
+		glDeleteProgram( shader_program );
+	}
+}
+
+/* Acivates a shader */
+void Shader::activate(){
+	if( !GLEW_VERSION_2_0 ) return;
+	GLState::useProgram( shader_program );
+
+	// send anything that was set while the shader wasn't active.
+	if( shader_program ){
+		for( unsigned int i = 0; i < uniforms.size(); ++i ){
+			if( uniforms[i].dirty ) uploadUniform( uniforms[i] );
+		}
+	}
+};
+
+/*! Activates FFP
+*/
+void Shader::deactivate(){
+	if( !GLEW_VERSION_2_0 ) return;
+	GLState::useProgram( 0 );
+}
+
+/*! Find the location of a uniform in the shader. If not there, returns -1.
+*/
+int Shader::getUniform( const std::string &uniform_name ) {
+	int handle = getUniformHandle( uniform_name );
+	return handle < 0 ? -1 : uniforms[handle].location;
+}
+
+/*! Gets the handle for a uniform, looking up the location the first time for names findUniforms() didn't see.
+*/
+int Shader::getUniformHandle( const std::string &uniform_name ) {
+	boost::unordered_map< std::string, int >::iterator it = uniform_handles.find( uniform_name );
+	if( it != uniform_handles.end() ) return it->second;
+	if( !shader_program ) return -1;
+
+	Uniform u = { glGetUniformLocation( shader_program, uniform_name.c_str() ), 0, false, false, 0, { 0, 0, 0, 0 } };
+	uniforms.push_back( u );
+	return uniform_handles[ uniform_name ] = uniforms.size() - 1;
+}
+
+void Shader::setUniform( const std::string &uniform_name, const int value ) {
+    setUniform( getUniformHandle(uniform_name), value );
+}
+
+void Shader::setUniform( const std::string &uniform_name, const float value ) {
+    setUniform( getUniformHandle(uniform_name), value );
+}
+
+void Shader::setUniform( const std::string &uniform_name, const Vector2d &value ) {
+    setUniform( getUniformHandle(uniform_name), value );
+}
+
+void Shader::setUniform( const std::string &uniform_name, const Color &value ) {
+    setUniform( getUniformHandle(uniform_name), value );
+}
+
+void Shader::setUniform( const std::string &uniform_name, const TexturePtr value ) {
+    setUniform( getUniformHandle(uniform_name), value );
+}
+
+void Shader::setUniform( const int handle, const int value ) {
+    setUniformValue( handle, (GLint) value );
+}
+
+void Shader::setUniform( const int handle, const float value ) {
+    setUniformValue( handle, &value, 1 );
+}
+
+void Shader::setUniform( const int handle, const Vector2d &value ) {
+    const GLfloat v[2] = { value.getX(), value.getY() };
+    setUniformValue( handle, v, 2 );
+}
+
+void Shader::setUniform( const int handle, const Color &value ) {
+    const GLfloat v[4] = { (GLfloat)value.getRed()/255.0f, (GLfloat)value.getGreen()/255.0f, (GLfloat)value.getBlue()/255.0f, (GLfloat)value.getAlpha()/255.0f };
+    setUniformValue( handle, v, 4 );
+}
+
+void Shader::setUniform( const int handle, const TexturePtr value ) {
+    setUniformValue( handle, (GLint) value->getTextureId() );
+}
+
+/*! Keeps an int value, and sends it if it changed.
+*/
+void Shader::setUniformValue( const int handle, const GLint value ) {
+	if( handle < 0 || handle >= (int) uniforms.size() ) return;
+	Uniform& u = uniforms[handle];
+	if( u.location < 0 || ( u.set && u.components == 0 && u.ivalue == value ) ) return;
+
+	u.components = 0;
+	u.ivalue = value;
+	u.set = u.dirty = true;
+	if( GLState::isCurrentProgram( shader_program ) ) uploadUniform( u );
+}
+
+/*! Keeps a float value, and sends it if it changed.
+*/
+void Shader::setUniformValue( const int handle, const GLfloat* value, const unsigned char components ) {
+	if( handle < 0 || handle >= (int) uniforms.size() ) return;
+	Uniform& u = uniforms[handle];
+	if( u.location < 0 ) return;
+
+	bool same = u.set && u.components == components;
+	for( unsigned char i = 0; same && i < components; ++i ) same = u.fvalue[i] == value[i];
+	if( same ) return;
+
+	u.components = components;
+	for( unsigned char i = 0; i < components; ++i ) u.fvalue[i] = value[i];
+	u.set = u.dirty = true;
+	if( GLState::isCurrentProgram( shader_program ) ) uploadUniform( u );
+}
+
+/*! Sends a uniform to OpenGL, the shader must be active.
+*/
+void Shader::uploadUniform( Uniform& u ) {
+	switch( u.components ){
+		case 0: glUniform1i( u.location, u.ivalue ); break;
+		case 1: glUniform1f( u.location, u.fvalue[0] ); break;
+		case 2: glUniform2f( u.location, u.fvalue[0], u.fvalue[1] ); break;
+		default: glUniform4f( u.location, u.fvalue[0], u.fvalue[1], u.fvalue[2], u.fvalue[3] ); break;
+	}
+	u.dirty = false;
+}
+
+/*! Gets the location of every active uniform, so names don't have to be looked up as they're set.
+	Arrays can be found by their name with or without "[0]".
+*/
+void Shader::findUniforms(){
+	uniform_handles.clear();
+	uniforms.clear();
+	if( !shader_program ) return;
+
+	GLint count = 0, max_length = 0;
+	glGetProgramiv( shader_program, GL_ACTIVE_UNIFORMS, &count );
+	glGetProgramiv( shader_program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length );
+	if( count <= 0 || max_length <= 0 ) return;
+
+	std::vector< GLchar > name( max_length + 1 );
+	for( GLint i = 0; i < count; ++i ){
+		GLsizei length = 0;
+		GLint size = 0;
+		GLenum type = 0;
+		glGetActiveUniform( shader_program, i, max_length, &length, &size, &type, &name[0] );
+		if( length <= 0 ) continue;
+
+		std::string uniform_name( &name[0], length );
+		getUniformHandle( uniform_name );
+
+		if( uniform_name.size() > 3 && uniform_name.compare( uniform_name.size() - 3, 3, "[0]" ) == 0 ){
+			uniform_handles[ uniform_name.substr( 0, uniform_name.size() - 3 ) ] = uniform_handles[ uniform_name ];
+		}
+	}
+}
+   
+
+/*! Loads shader files, compiles them and links them
+*/
+bool Shader::load( const std::string& vertex_file, const std::string& fragment_file ){
+	const std::string vertex_source = getFileContents( vertex_file ), fragment_source = getFileContents( fragment_file );
+	return build( vertex_source.c_str(), vertex_source.size(), fragment_source.c_str(), fragment_source.size() );
+}
+
+/*! Loads shaders from a string, compiles, and links them */
+bool Shader::loadFromString( const std::string& vertex_source, const std::string& fragment_source ){
+	return build( vertex_source.c_str(), vertex_source.size(), fragment_source.c_str(), fragment_source.size() );
+}
+
+/*! Loads shaders from an asset pack, compiles, and links them
+*/
+bool Shader::load( const AssetPack& _pack, const std::string& vertex_file, const std::string& fragment_file ){
+	const unsigned char* vertex_data, * fragment_data;
+	unsigned int vertex_size, fragment_size;
+
+	if( !_pack.find( vertex_file, vertex_data, vertex_size ) ){
+		addError( "Vertex shader not found in pack: " + vertex_file );
+		return false;
+	}
+	if( !_pack.find( fragment_file, fragment_data, fragment_size ) ){
+		addError( "Fragment shader not found in pack: " + fragment_file );
+		return false;
+	}
+
+	return build( (const char*) vertex_data, vertex_size, (const char*) fragment_data, fragment_size );
+}
+
+/*! Compiles and links a vertex and fragment shader, or loads the linked program from the program cache.
+*/
+bool Shader::build( const char* vertex_source, const int vertex_length, const char* fragment_source, const int fragment_length ){
+	const std::string cache = getProgramCachePath( vertex_source, vertex_length, fragment_source, fragment_length );
+	if( cache.size() && loadProgramBinary( cache ) ) return true;
+
+	vertex_shader = compile( GL_VERTEX_SHADER, vertex_source, vertex_length );
+	fragment_shader = compile( GL_FRAGMENT_SHADER, fragment_source, fragment_length );
+
+	if( !vertex_shader || ! fragment_shader ) return false;
+
+	shader_program = link();
+
+	if( !shader_program ) return false;
+
+	if( cache.size() ) saveProgramBinary( cache );
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Program binary cache
+////////////////////////////////////////////////////////////////////////////////
+
+std::string Shader::program_cache_dir;
+
+// Cache files start with this, then the binary format and the binary's length.
+static const char program_cache_magic[8] = { 'P', 'H', 'X', 'P', 'R', 'O', 'G', '1' };
+
+/*
+	64-bit FNV-1a, continued from _h.
+*/
+static unsigned long long hashBytes( const char* _s, unsigned int _len, unsigned long long _h = 14695981039346656037ULL )
+{
+	for( unsigned int i = 0; i < _len; ++i )
+	{
+		_h ^= (unsigned char) _s[i];
+		_h *= 1099511628211ULL;
+	}
+	return _h;
+}
+
+static unsigned long long hashString( const GLubyte* _s, unsigned long long _h )
+{
+	const char* s = _s ? (const char*) _s : "";
+	return hashBytes( s, std::strlen( s ) + 1, _h );
+}
+
+/*! Checks that program binaries can be gotten and loaded, and that the driver has at least one format for them.
+*/
+bool Shader::programBinariesSupported(){
+	if( !GLEW_VERSION_2_0 || !( GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary ) ) return false;
+	GLint formats = 0;
+	glGetIntegerv( GL_NUM_PROGRAM_BINARY_FORMATS, &formats );
+	return formats > 0;
+}
+
+/*! The cache file is named after a hash of both sources and the OpenGL vendor, renderer, and version,
+	so a new driver or a different card never loads a binary made by another.
+*/
+std::string Shader::getProgramCachePath( const char* vertex_source, const int vertex_length, const char* fragment_source, const int fragment_length ){
+	if( program_cache_dir.empty() || !programBinariesSupported() ) return std::string();
+
+	unsigned long long h = hashBytes( vertex_source, vertex_length );
+	h = hashBytes( "", 1, h );
+	h = hashBytes( fragment_source, fragment_length, h );
+	h = hashBytes( "", 1, h );
+	h = hashString( glGetString( GL_VENDOR ), h );
+	h = hashString( glGetString( GL_RENDERER ), h );
+	h = hashString( glGetString( GL_VERSION ), h );
+
+	std::stringstream path;
+	path<<program_cache_dir<<std::hex<<std::setw(16)<<std::setfill('0')<<h<<".bin";
+	return path.str();
+}
+
+/*! Loads the linked program from a cache file. If the file isn't there, or the driver won't take it
+	(it's from a different driver build, say), this returns false and the shader is compiled instead.
+*/
+bool Shader::loadProgramBinary( const std::string& _path ){
+	std::ifstream file( _path.c_str(), std::ios::in | std::ios::binary );
+	if( !file.is_open() ) return false;
+
+	char magic[8];
+	GLenum format = 0;
+	GLint length = 0;
+	file.read( magic, sizeof( magic ) );
+	file.read( (char*) &format, sizeof( format ) );
+	file.read( (char*) &length, sizeof( length ) );
+	if( !file.good() || std::memcmp( magic, program_cache_magic, sizeof( magic ) ) != 0 || length <= 0 ) return false;
+
+	// The length has to fit in what's left of the file, so a corrupt header can't ask for a huge allocation.
+	const std::streampos start = file.tellg();
+	file.seekg( 0, std::ios::end );
+	const std::streamoff remaining = file.tellg() - start;
+	file.seekg( start );
+	if( !file.good() || remaining < (std::streamoff) length ) return false;
+
+	std::vector< char > binary( length );
+	file.read( &binary[0], length );
+	if( file.gcount() != length ) return false;
+
+	GLuint program = glCreateProgram();
+	glProgramBinary( program, format, &binary[0], length );
+
+	GLint program_ok = GL_FALSE;
+	glGetProgramiv( program, GL_LINK_STATUS, &program_ok );
+	if( !program_ok ){
+		glDeleteProgram( program );
+		return false;
+	}
+
+	shader_program = program;
+	findUniforms();
+	return true;
+}
+
+/*! Saves the linked program to a cache file.
+*/
+bool Shader::saveProgramBinary( const std::string& _path ){
+	GLint length = 0;
+	glGetProgramiv( shader_program, GL_PROGRAM_BINARY_LENGTH, &length );
+	if( length <= 0 ) return false;
+
+	std::vector< char > binary( length );
+	GLenum format = 0;
+	GLsizei written = 0;
+	glGetProgramBinary( shader_program, length, &written, &format, &binary[0] );
+	if( written <= 0 ) return false;
+
+	std::ofstream file( _path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+	if( !file.is_open() ) return false;
+
+	const GLint size = written;
+	file.write( program_cache_magic, sizeof( program_cache_magic ) );
+	file.write( (const char*) &format, sizeof( format ) );
+	file.write( (const char*) &size, sizeof( size ) );
+	file.write( &binary[0], size );
+	return file.good();
+}
+
+/*! Compiles a specific shader, usually not called directly
+*/
+GLuint Shader::compile( GLenum _type, const std::string& _source ){
+	return compile( _type, _source.c_str(), _source.size() );
+}
+
+/*! Compiles a specific shader from a range of characters
+*/
+GLuint Shader::compile( GLenum _type, const char* _source, const int _length ){
+	if( !GLEW_VERSION_2_0 ) return 0;
+
+	// create a shader object
+	GLuint shader = glCreateShader(_type);
+
+	// compile it
+	const GLchar* src = _source;
+	const GLint size = _length;
+	glShaderSource(shader, 1, &src, &size);
+	glCompileShader(shader);
+
+	//check it
+	GLint shader_ok;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &shader_ok);
+	if (!shader_ok) {
+		addError("Failed to compile shader object:");
+		show_info_log(shader, glGetShaderiv, glGetShaderInfoLog);
+		glDeleteShader(shader);
+		return 0;
+	}
+
+	return shader;
+}
+
+/*! Links the shader program
+*/
+GLuint Shader::link(){
+	if( !GLEW_VERSION_2_0 ) return 0;
+	GLint program_ok;
+
+	GLuint program = glCreateProgram();
+	glAttachShader(program, vertex_shader);
+	glAttachShader(program, fragment_shader);
+
+	// some drivers only keep a binary that can be gotten back if they're asked to before linking.
+	if( program_cache_dir.size() && programBinariesSupported() ) glProgramParameteri( program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
+
+	glLinkProgram(program);
+
+	glGetProgramiv(program, GL_LINK_STATUS, &program_ok);
+	if (!program_ok) {
+		addError("Failed to link shader program:");
+		show_info_log(program, glGetProgramiv, glGetProgramInfoLog);
+		glDeleteProgram(program);
+
+		shader_program = 0;
+		findUniforms();
+		return 0;
+	} else {
+		shader_program = program;
+		findUniforms();
+		return program;
+	}
+}
+
+
+/* Adds a string to the error log */
+void Shader::addError( const std::string& _error ){
+	errors += _error + std::string("\n");
+}
+
+/*! Retrieves errors from OpenGL */
+void Shader::show_info_log(
+	GLuint object,
+	PFNGLGETSHADERIVPROC glGet__iv,
+	PFNGLGETSHADERINFOLOGPROC glGet__InfoLog
+)
+{
+	GLint log_length;
+	char *log;
+
+	glGet__iv(object, GL_INFO_LOG_LENGTH, &log_length);
+	log = (char *)malloc(log_length);
+	glGet__InfoLog(object, log_length, NULL, log);
+	addError(log);
+	free(log);
+}
+
+/* Reads and entire file and returns it as a string */
+const std::string Shader::getFileContents( const std::string& file_name ){
+	std::ifstream file;
+	file.open( file_name.c_str(), std::ios::in );
+
+	if( !file.is_open() || !file.good() ) return std::string("");
+
+	std::stringstream buffer;
+	buffer << file.rdbuf();
+
+	return buffer.str();
 }
\ No newline at end of file
@@ -0,0 +1,174 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <algorithm>
+#include <cstring>
+#include "TextGeometry.h"
+
+using namespace phoenix;
+
+TextGeometry::TextGeometry( BitmapFontPtr _f, const std::string& _s, const Vector2d& _p, const Color& _c, const Vector2d& _scale, E_TEXT_ALIGNMENT _align, bool _immediate )
+	: BatchGeometryComposite( *_f->getBatchRenderer() ), font(_f), text(_s), codepoints(), decoded(), position(_p), color(_c),
+	text_scale( _scale != Vector2d(0,0) ? _scale : _f->getScale() ), alignment(_align), dimensions(), placements(), line_widths(), layout_count(0), update_count(0)
+{
+	immediate = _immediate;
+	setGroup( _f->getGroup() );
+	setDepth( _f->getDepth() );
+	update();
+	BitmapFont::decodeText( text, codepoints );
+	layout();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Properties
+////////////////////////////////////////////////////////////////////////////////
+
+void TextGeometry::setText( const std::string& _s )
+{
+	setText( _s.c_str() );
+}
+
+void TextGeometry::setText( const char* _s )
+{
+	const unsigned int len = std::strlen( _s );
+	if( len == text.size() && std::memcmp( _s, text.data(), len ) == 0 ) return;
+
+	text.assign( _s, len );
+	BitmapFont::decodeText( text, decoded );
+
+	if( !updateInPlace() )
+	{
+		codepoints.swap( decoded );
+		layout();
+	}
+}
+
+void TextGeometry::setPosition( const Vector2d& _p )
+{
+	translate( _p - position );
+	position = _p;
+}
+
+void TextGeometry::setColor( const Color& _c )
+{
+	if( _c.getRed() == color.getRed() && _c.getGreen() == color.getGreen() && _c.getBlue() == color.getBlue() && _c.getAlpha() == color.getAlpha() ) return;
+	color = _c;
+	colorize( _c );
+}
+
+void TextGeometry::setTextScale( const Vector2d& _s )
+{
+	if( _s == text_scale ) return;
+	text_scale = _s;
+	layout();
+}
+
+void TextGeometry::setAlignment( E_TEXT_ALIGNMENT _a )
+{
+	if( _a == alignment ) return;
+	alignment = _a;
+	layout();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Layout
+////////////////////////////////////////////////////////////////////////////////
+
+void TextGeometry::writeGlyph( const Placement& _pl, unsigned int _cp )
+{
+	Vertex quad[4];
+	font->glyphQuad( _cp, _pl, position, lineOffset( _pl.line ), color, text_scale, quad );
+
+	BatchGeometry& geom = *geoms[_pl.page];
+	for( unsigned int i = 0; i < 4; ++i ) geom[ _pl.vertex + i ] = quad[i];
+}
+
+/*
+	The font lays the text out (the same way as BitmapFont::drawText()), and writes
+	it into the children now that the lines can be aligned.
+*/
+void TextGeometry::layout()
+{
+	++layout_count;
+
+	// One child for each page, reusing what's there so their storage is kept.
+	const unsigned int page_count = font->getPageCount();
+	for( unsigned int i = geoms.size(); i < page_count; ++i )
+	{
+		BatchGeometryPtr geom = new BatchGeometry( renderer, GL_QUADS, font->getPage(i), groupid, depth );
+		geom->setImmediate( immediate );
+		geom->setEnabled( enabled );
+		add( geom );
+	}
+	BOOST_FOREACH( BatchGeometryPtr& g, geoms ){
+		g->clear();
+	}
+
+	dimensions = font->layoutText( codepoints, text_scale, placements, line_widths );
+	font->writeText( codepoints, placements, line_widths, dimensions.getX(), position, color, text_scale, alignment, geoms.empty() ? 0 : &geoms[0], geoms.size() );
+}
+
+float TextGeometry::lineOffset( unsigned int _line ) const
+{
+	return BitmapFont::getAlignmentOffset( alignment, dimensions.getX(), line_widths[_line] );
+}
+
+/*
+	Only the glyphs that changed (and the one before them, for kerning) are
+	rewritten. That's possible when they stay on the same line and pages and
+	the glyphs after them don't move, or they're at the end of a left aligned
+	line, otherwise the text is laid out again.
+*/
+bool TextGeometry::updateInPlace()
+{
+	const unsigned int len = decoded.size();
+	if( len != codepoints.size() || placements.size() != len ) return false;
+
+	unsigned int first = 0;
+	while( first < len && codepoints[first] == decoded[first] ) ++first;
+	if( first == len ) return true;
+
+	unsigned int last = len-1;
+	while( codepoints[last] == decoded[last] ) --last;
+
+	// The glyph before the change may have a different kerning now.
+	const unsigned int start = first > 0 && codepoints[first-1] != '\n' ? first-1 : first;
+
+	float pen_x = placements[start].pen_x;
+	for( unsigned int i = start; i <= last; ++i )
+	{
+		if( decoded[i] == '\n' || codepoints[i] == '\n' || placements[i].page == BitmapFont::NO_PAGE ) return false;
+		if( font->getCharacter( decoded[i] ).page != placements[i].page ) return false;
+		pen_x += font->getAdvance( decoded, i, text_scale );
+	}
+
+	const bool line_end = last+1 == len || decoded[last+1] == '\n';
+	if( line_end ){
+		if( alignment != T_ALIGN_LEFT && pen_x != line_widths[ placements[last].line ] ) return false;
+	} else if( pen_x != placements[last+1].pen_x ) return false;
+
+	codepoints.swap( decoded );
+
+	const unsigned int line = placements[start].line;
+	if( line_end ){
+		line_widths[line] = pen_x;
+		dimensions.setX( *std::max_element( line_widths.begin(), line_widths.end() ) );
+	}
+
+	pen_x = placements[start].pen_x;
+	for( unsigned int i = start; i <= last; ++i )
+	{
+		placements[i].pen_x = pen_x;
+		writeGlyph( placements[i], codepoints[i] );
+		pen_x += font->getAdvance( codepoints, i, text_scale );
+	}
+
+	++update_count;
+	return true;
+}
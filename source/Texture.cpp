@@ -1,178 +1,377 @@
- /*
-
-Copyright (c) 2010, Jonathan Wayne Parrott
-
-Please see the license.txt file included with this source
-distribution for more information.
-
-*/
-
-#include "Texture.h"
-
-using namespace phoenix;
-
-
-/*!--------------------------
-Build a blank texture
-----------------------------*/
-void Texture::build( const Vector2d& _s, const Color& _c )
-{
-
-    unsigned int a = (unsigned int)_s.getX();
-	unsigned int b = (unsigned int)_s.getY();
-
-	//! If they supplied width and height, lets make a blank texture.
-	if( (a>0) && (b>0) )
-	{
-
-		// let our texture know what it's new width and height will be.
-	    setWidth( a );
-	    setHeight( b );
-
-		//make some room for the texture's data
-		data = new GLubyte[a*b*4];
-
-		//make all the pixels the given color.
-		for( unsigned int i = 0; i < a; ++i )
-		{
-			for( unsigned int j = 0; j < b; ++j )
-			{
-				setPixel( Vector2d( (float) i, (float) j ), _c );
-			}
-		}
-
-		//Generate a texture, if we're not already one.
-		if( ! glIsTexture(texture) )
-		{
-			glGenTextures(1,&texture);
-		}
-
-		//write the texture
-		unlock();
-
-		//set the parameters
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-	}
-}
-
-////////////////////////////////////////////////////////////////////////////////
-// write and read pixel functions
-////////////////////////////////////////////////////////////////////////////////
-
-void Texture::setPixel( const Vector2d& _p, const Color& _c)
-{
-    const unsigned int x = (const unsigned int) _p.getX();
-    const unsigned int y = (const unsigned int) _p.getY();
-    if (data!=NULL)
-    {
-
-        *(data+(((y*width)+x)*4)) = _c.getRed();
-        *(data+(((y*width)+x)*4)+1) = _c.getGreen();
-        *(data+(((y*width)+x)*4)+2) = _c.getBlue();
-        *(data+(((y*width)+x)*4)+3) = _c.getAlpha();
-
-    }
-
-}
-
-const Color Texture::getPixel( const Vector2d& _p ) const
-{
-    const unsigned int x = ( const unsigned int) _p.getX();
-    const unsigned int y = ( const unsigned int) _p.getY();
-    if (data!=NULL)
-    {
-
-        Color col;
-        col.setRed(*(data+(((y*width)+x)*4)));
-        col.setGreen(*(data+(((y*width)+x)*4)+1));
-        col.setBlue(*(data+(((y*width)+x)*4)+2));
-        col.setAlpha(*(data+(((y*width)+x)*4)+3));
-        return col;
-
-    }
-    else
-    {
-        return Color(255,255,255,255);
-	}
-}
-
-////////////////////////////////////////////////////////////////////////////////
-// lock and unlock texture
-////////////////////////////////////////////////////////////////////////////////
-
-void Texture::unlock()
-{
-    if (data!=NULL)
-    {
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-
-        delete [] data;
-
-        data = NULL;
-    }
-}
-
-void Texture::unlock(bool BGRA)
-{
-    if (data!=NULL)
-    {
-        glBindTexture(GL_TEXTURE_2D, texture);
-		if(!BGRA)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-		else
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_BGRA_EXT, GL_UNSIGNED_BYTE, data);
-
-        delete [] data;
-
-        data = NULL;
-    }
-}
-
-bool Texture::lock()
-{
-    data = new GLubyte[width*height*4];
-    if (data!=NULL)
-    {
-    	glBindTexture(GL_TEXTURE_2D, texture);
-        glGetTexImage( GL_TEXTURE_2D , 0 , GL_RGBA , GL_UNSIGNED_BYTE, data );
-        return true;
-    }
-    else
-    {
-        return false;
-    }
-}
-
-////////////////////////////////////////////////////////////////////////////////
-// Copy texture
-////////////////////////////////////////////////////////////////////////////////
-
-boost::intrusive_ptr<Texture> Texture::copy()
-{
-     // Generate the destination texture
-     GLuint nTexID_out = 0;
-     glGenTextures( 1, &nTexID_out );
-     glBindTexture( GL_TEXTURE_2D, nTexID_out );
-     glTexParameteri( GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER, GL_LINEAR );
-     glTexParameteri( GL_TEXTURE_2D,GL_TEXTURE_MAG_FILTER, GL_LINEAR );
-
-     // bind the source texture and get the texels
-     lock();
-
-     // bind the output texture and copy the image
-     glBindTexture( GL_TEXTURE_2D, nTexID_out );
-     glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, width,height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data );
-
-     unlock();
-
-     TexturePtr newtexture = new Texture( getResourceManager() );
-     newtexture->setTextureId( nTexID_out );
-     newtexture->setWidth( width );
-     newtexture->setHeight( height );
-     newtexture->setName( getName() + " copy" );
-
-     return newtexture;
-}
+ /*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include "Texture.h"
+#include "TextureReadback.h"
+#include "soil/SOIL.h"
+#include <vector>
+
+using namespace phoenix;
+
+//! Checks that every pixel of some RGBA data has an alpha of 255.
+static bool isOpaque( const GLubyte* _data, unsigned int _pixels )
+{
+	for( unsigned int i = 0; i < _pixels; ++i )
+	{
+		if( _data[ i*4 + 3 ] != 255 ) return false;
+	}
+	return true;
+}
+
+
+/*!--------------------------
+Build a blank texture
+----------------------------*/
+void Texture::build( const Vector2d& _s, const Color& _c )
+{
+
+    unsigned int a = (unsigned int)_s.getX();
+	unsigned int b = (unsigned int)_s.getY();
+
+	//! If they supplied width and height, lets make a blank texture.
+	if( (a>0) && (b>0) )
+	{
+
+		// let our texture know what it's new width and height will be.
+	    setWidth( a );
+	    setHeight( b );
+
+		//make some room for the texture's data
+		data = new GLubyte[a*b*4];
+
+		//make all the pixels the given color.
+		for( unsigned int i = 0; i < a; ++i )
+		{
+			for( unsigned int j = 0; j < b; ++j )
+			{
+				setPixel( Vector2d( (float) i, (float) j ), _c );
+			}
+		}
+
+		//Generate a texture, if we're not already one.
+		if( ! glIsTexture(texture) )
+		{
+			glGenTextures(1,&texture);
+		}
+
+		//write the texture
+		unlock();
+
+		//set the parameters
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	}
+}
+
+void Texture::allocate( const Vector2d& _s, GLenum _format )
+{
+	GLsizei a = (GLsizei)_s.getX();
+	GLsizei b = (GLsizei)_s.getY();
+
+	if( (a<=0) || (b<=0) ) return;
+
+	if( ! texture )
+	{
+		glGenTextures(1,&texture);
+	}
+
+	GLState::bindTexture( texture );
+	glTexImage2D(GL_TEXTURE_2D, 0, _format, a, b, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	opaque = false;
+	source.clear();
+	evicted = false;
+	queryFormat();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// write and read pixel functions
+////////////////////////////////////////////////////////////////////////////////
+
+void Texture::setPixel( const Vector2d& _p, const Color& _c)
+{
+    const unsigned int x = (const unsigned int) _p.getX();
+    const unsigned int y = (const unsigned int) _p.getY();
+    if (data!=NULL)
+    {
+
+        *(data+(((y*width)+x)*4)) = _c.getRed();
+        *(data+(((y*width)+x)*4)+1) = _c.getGreen();
+        *(data+(((y*width)+x)*4)+2) = _c.getBlue();
+        *(data+(((y*width)+x)*4)+3) = _c.getAlpha();
+
+    }
+
+}
+
+const Color Texture::getPixel( const Vector2d& _p ) const
+{
+    const unsigned int x = ( const unsigned int) _p.getX();
+    const unsigned int y = ( const unsigned int) _p.getY();
+    if (data!=NULL)
+    {
+
+        Color col;
+        col.setRed(*(data+(((y*width)+x)*4)));
+        col.setGreen(*(data+(((y*width)+x)*4)+1));
+        col.setBlue(*(data+(((y*width)+x)*4)+2));
+        col.setAlpha(*(data+(((y*width)+x)*4)+3));
+        return col;
+
+    }
+    else
+    {
+        return Color(255,255,255,255);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// lock and unlock texture
+////////////////////////////////////////////////////////////////////////////////
+
+void Texture::unlock()
+{
+    if (data!=NULL)
+    {
+        opaque = isOpaque( data, width * height );
+        GLState::bindTexture( texture );
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+
+        internal_format = GL_RGBA;
+        compressed = false;
+        memory_usage = 0;
+        source.clear();
+        evicted = false;
+
+        delete [] data;
+
+        data = NULL;
+    }
+}
+
+void Texture::unlock(bool BGRA)
+{
+    if (data!=NULL)
+    {
+        opaque = isOpaque( data, width * height );
+        GLState::bindTexture( texture );
+		if(!BGRA)
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+		else
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_BGRA_EXT, GL_UNSIGNED_BYTE, data);
+
+        internal_format = GL_RGBA;
+        compressed = false;
+        memory_usage = 0;
+        source.clear();
+        evicted = false;
+
+        delete [] data;
+
+        data = NULL;
+    }
+}
+
+bool Texture::lock()
+{
+    if( evicted ) restore();
+    data = new GLubyte[width*height*4];
+    if (data!=NULL)
+    {
+    	GLState::bindTexture( texture );
+        glGetTexImage( GL_TEXTURE_2D , 0 , GL_RGBA , GL_UNSIGNED_BYTE, data );
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Opacity
+////////////////////////////////////////////////////////////////////////////////
+
+bool Texture::detectOpaque()
+{
+	if( evicted ) restore();
+	if( ! glIsTexture(texture) || width <= 0 || height <= 0 ) return opaque = false;
+
+	if( internal_format == GL_COMPRESSED_RGB_S3TC_DXT1_EXT ) return opaque = true;
+
+	// Only the alpha channel is read back.
+	std::vector< GLubyte > alpha( width * height );
+	GLState::bindTexture( texture );
+	glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+	glGetTexImage( GL_TEXTURE_2D, 0, GL_ALPHA, GL_UNSIGNED_BYTE, &alpha[0] );
+	glPixelStorei( GL_PACK_ALIGNMENT, 4 );
+
+	opaque = true;
+	for( unsigned int i = 0; i < alpha.size() && opaque; ++i )
+		opaque = alpha[i] == 255;
+	return opaque;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Format query
+////////////////////////////////////////////////////////////////////////////////
+
+void Texture::queryFormat()
+{
+	if( ! glIsTexture(texture) ) return;
+
+	GLint w = 0, h = 0, format = GL_RGBA, is_compressed = GL_FALSE;
+
+	GLState::bindTexture( texture );
+	glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &w );
+	glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &h );
+	glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format );
+	glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED, &is_compressed );
+
+	setWidth( w );
+	setHeight( h );
+	internal_format = (GLenum) format;
+	compressed = ( is_compressed == GL_TRUE );
+
+	// Bytes per pixel of uncompressed formats, drivers pad RGB out to 4.
+	unsigned int bpp = 4;
+	switch( internal_format )
+	{
+	case GL_ALPHA: case GL_ALPHA8: case GL_LUMINANCE: case GL_LUMINANCE8: case GL_INTENSITY: case GL_INTENSITY8:
+		bpp = 1;
+		break;
+	case GL_LUMINANCE_ALPHA: case GL_LUMINANCE8_ALPHA8:
+		bpp = 2;
+		break;
+	default:
+		break;
+	}
+
+	// Add up the whole mip chain.
+	memory_usage = 0;
+	for( GLint level = 0; w > 0 && h > 0; ++level )
+	{
+		if( compressed )
+		{
+			GLint size = 0;
+			glGetTexLevelParameteriv( GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size );
+			memory_usage += (boost::uint64_t) size;
+		}
+		else
+		{
+			memory_usage += (boost::uint64_t) w * h * bpp;
+		}
+
+		if( w == 1 && h == 1 ) break;
+		w = h = 0;
+		glGetTexLevelParameteriv( GL_TEXTURE_2D, level+1, GL_TEXTURE_WIDTH, &w );
+		glGetTexLevelParameteriv( GL_TEXTURE_2D, level+1, GL_TEXTURE_HEIGHT, &h );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Eviction
+////////////////////////////////////////////////////////////////////////////////
+
+bool Texture::evict()
+{
+	if( evicted || source.empty() || data != NULL || !glIsTexture(texture) ) return false;
+
+	static const GLubyte blank[4] = { 255, 255, 255, 255 };
+
+	// Replace the image with a single pixel, and empty the mip levels.
+	GLState::bindTexture( texture );
+	for( GLint level = 1; ; ++level )
+	{
+		GLint w = 0;
+		glGetTexLevelParameteriv( GL_TEXTURE_2D, level, GL_TEXTURE_WIDTH, &w );
+		if( w == 0 ) break;
+		glTexImage2D( GL_TEXTURE_2D, level, GL_RGBA, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL );
+	}
+	glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, blank );
+
+	evicted = true;
+	return true;
+}
+
+bool Texture::restore()
+{
+	if( !evicted ) return true;
+	evicted = false;
+
+	// SOIL sets its own filtering, so hang on to ours.
+	GLint min_filter = GL_LINEAR, mag_filter = GL_LINEAR;
+	GLState::bindTexture( texture );
+	glGetTexParameteriv( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &min_filter );
+	glGetTexParameteriv( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, &mag_filter );
+
+	int w = 0, h = 0;
+	GLuint id = SOIL_load_OGL_texture( source.c_str(), SOIL_LOAD_RGBA, texture, source_flags, &w, &h );
+
+	// SOIL binds textures without going through GLState.
+	GLState::forgetTextures();
+	GLState::bindTexture( texture );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, min_filter );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, mag_filter );
+
+	// If the file is gone, keep the placeholder and never try again.
+	if( id == 0 )
+	{
+		source.clear();
+		return false;
+	}
+
+	queryFormat();
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Asynchronous readback
+////////////////////////////////////////////////////////////////////////////////
+
+boost::intrusive_ptr<TextureReadback> Texture::readback()
+{
+	if( evicted ) restore();
+	return new TextureReadback( *this );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Copy texture
+////////////////////////////////////////////////////////////////////////////////
+
+boost::intrusive_ptr<Texture> Texture::copy()
+{
+     // Generate the destination texture
+     GLuint nTexID_out = 0;
+     glGenTextures( 1, &nTexID_out );
+     GLState::bindTexture( nTexID_out );
+     glTexParameteri( GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+     glTexParameteri( GL_TEXTURE_2D,GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+
+     // bind the source texture and get the texels
+     lock();
+
+     // bind the output texture and copy the image
+     GLState::bindTexture( nTexID_out );
+     glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, width,height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data );
+
+     unlock();
+
+     TexturePtr newtexture = new Texture( getResourceManager() );
+     newtexture->setTextureId( nTexID_out );
+     newtexture->setWidth( width );
+     newtexture->setHeight( height );
+     newtexture->setName( getName() + " copy" );
+     newtexture->setOpaque( opaque );
+
+     return newtexture;
+}
@@ -0,0 +1,140 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include "TextureReadback.h"
+
+using namespace phoenix;
+
+/*!--------------------------
+Start the transfer
+----------------------------*/
+TextureReadback::TextureReadback( Texture& _t )
+	: Droppable(), pbo(0), fence(0), width( _t.getWidth() ), height( _t.getHeight() ), data(NULL), fallback(NULL)
+{
+	if( width <= 0 || height <= 0 ) return;
+
+	GLState::bindTexture( _t.getTextureId( ) );
+
+	if( isAsyncSupported() )
+	{
+		// Queue the copy into a pixel buffer, glGetTexImage returns immediately when a pack buffer is bound.
+		glGenBuffers( 1, &pbo );
+		glBindBuffer( GL_PIXEL_PACK_BUFFER, pbo );
+		glBufferData( GL_PIXEL_PACK_BUFFER, width*height*4, NULL, GL_STREAM_READ );
+		glGetTexImage( GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0 );
+		glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+
+		// Fence it so we can tell when it's done, and make sure the commands are actually sent.
+		fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+		glFlush();
+	}
+	else
+	{
+		fallback = new GLubyte[width*height*4];
+		glGetTexImage( GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, fallback );
+	}
+}
+
+TextureReadback::~TextureReadback()
+{
+	unmap();
+	if( fence ) glDeleteSync( fence );
+	if( pbo ) glDeleteBuffers( 1, &pbo );
+	if( fallback != NULL ) delete [] fallback;
+}
+
+bool TextureReadback::isAsyncSupported()
+{
+	return ( GLEW_VERSION_2_1 || GLEW_ARB_pixel_buffer_object ) && ( GLEW_VERSION_3_2 || GLEW_ARB_sync );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Fence checking
+////////////////////////////////////////////////////////////////////////////////
+
+bool TextureReadback::ready()
+{
+	if( !fence ) return true;
+
+	GLenum result = glClientWaitSync( fence, 0, 0 );
+	if( result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED )
+	{
+		glDeleteSync( fence );
+		fence = 0;
+		return true;
+	}
+	return false;
+}
+
+void TextureReadback::wait()
+{
+	if( !fence ) return;
+
+	// Wait in 1ms slices, flushing on the first so we can't wait on commands that were never sent.
+	GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+	while( glClientWaitSync( fence, flags, 1000000 ) == GL_TIMEOUT_EXPIRED )
+	{
+		flags = 0;
+	}
+
+	glDeleteSync( fence );
+	fence = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Map and unmap
+////////////////////////////////////////////////////////////////////////////////
+
+const GLubyte* TextureReadback::map()
+{
+	if( data != NULL ) return data;
+
+	if( !pbo )
+	{
+		data = fallback;
+		return data;
+	}
+
+	wait();
+
+	glBindBuffer( GL_PIXEL_PACK_BUFFER, pbo );
+	data = (GLubyte*) glMapBuffer( GL_PIXEL_PACK_BUFFER, GL_READ_ONLY );
+	glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+
+	return data;
+}
+
+void TextureReadback::unmap()
+{
+	if( data == NULL ) return;
+
+	if( pbo )
+	{
+		glBindBuffer( GL_PIXEL_PACK_BUFFER, pbo );
+		glUnmapBuffer( GL_PIXEL_PACK_BUFFER );
+		glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+	}
+
+	data = NULL;
+}
+
+const Color TextureReadback::getPixel( const Vector2d& _p ) const
+{
+	const unsigned int x = (const unsigned int) _p.getX();
+	const unsigned int y = (const unsigned int) _p.getY();
+	if( data != NULL )
+	{
+		const GLubyte* p = data + (((y*width)+x)*4);
+		return Color( p[0], p[1], p[2], p[3] );
+	}
+	else
+	{
+		return Color(255,255,255,255);
+	}
+}
@@ -0,0 +1,153 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include "VertexTransform.h"
+
+#if PH_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+using namespace phoenix;
+
+/*
+	Vertex is tcoords, color, then position, so positions are sizeof(Vertex) apart and can't be
+	loaded four at a time. The SSE2 paths load the x and y of two vertices into one register with
+	movlps/movhps, which gets the same work done per instruction without having to gather or scatter.
+*/
+
+//! Gets a pointer to the x (followed by y) of a vertex's position.
+static inline float* position( Vertex& _v )
+{
+	return reinterpret_cast< float* >( &_v.position );
+}
+
+#if PH_USE_SSE2
+
+static inline __m128 loadPair( Vertex* _v )
+{
+	__m128 r = _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast< const __m64* >( position( _v[0] ) ) );
+	return _mm_loadh_pi( r, reinterpret_cast< const __m64* >( position( _v[1] ) ) );
+}
+
+static inline void storePair( Vertex* _v, __m128 _r )
+{
+	_mm_storel_pi( reinterpret_cast< __m64* >( position( _v[0] ) ), _r );
+	_mm_storeh_pi( reinterpret_cast< __m64* >( position( _v[1] ) ), _r );
+}
+
+void phoenix::transformVertices( Vertex* _v, unsigned int _n, const AffineTransform& _a )
+{
+	const __m128 ad = _mm_setr_ps( _a.a, _a.d, _a.a, _a.d );
+	const __m128 bc = _mm_setr_ps( _a.b, _a.c, _a.b, _a.c );
+	const __m128 t = _mm_setr_ps( _a.tx, _a.ty, _a.tx, _a.ty );
+
+	unsigned int i = 0;
+	for( ; i + 1 < _n; i += 2 )
+	{
+		// ( x, y ) * ( a, d ) + ( y, x ) * ( b, c ) + ( tx, ty ), for both vertices.
+		__m128 p = loadPair( _v + i );
+		__m128 s = _mm_shuffle_ps( p, p, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+		storePair( _v + i, _mm_add_ps( _mm_add_ps( _mm_mul_ps( p, ad ), _mm_mul_ps( s, bc ) ), t ) );
+	}
+	if( i < _n )
+	{
+		float* p = position( _v[i] );
+		const float x = p[0], y = p[1];
+		p[0] = _a.a * x + _a.b * y + _a.tx;
+		p[1] = _a.c * x + _a.d * y + _a.ty;
+	}
+}
+
+void phoenix::translateVertices( Vertex* _v, unsigned int _n, const Vector2d& _t )
+{
+	const __m128 t = _mm_setr_ps( _t.getX(), _t.getY(), _t.getX(), _t.getY() );
+	unsigned int i = 0;
+	for( ; i + 1 < _n; i += 2 )
+	{
+		storePair( _v + i, _mm_add_ps( loadPair( _v + i ), t ) );
+	}
+	if( i < _n )
+	{
+		float* p = position( _v[i] );
+		p[0] += _t.getX();
+		p[1] += _t.getY();
+	}
+}
+
+void phoenix::scaleVertices( Vertex* _v, unsigned int _n, const Vector2d& _s )
+{
+	const __m128 s = _mm_setr_ps( _s.getX(), _s.getY(), _s.getX(), _s.getY() );
+	unsigned int i = 0;
+	for( ; i + 1 < _n; i += 2 )
+	{
+		storePair( _v + i, _mm_mul_ps( loadPair( _v + i ), s ) );
+	}
+	if( i < _n )
+	{
+		float* p = position( _v[i] );
+		p[0] *= _s.getX();
+		p[1] *= _s.getY();
+	}
+}
+
+#else
+
+void phoenix::translateVertices( Vertex* _v, unsigned int _n, const Vector2d& _t )
+{
+	const float tx = _t.getX(), ty = _t.getY();
+	for( unsigned int i = 0; i < _n; ++i )
+	{
+		float* p = position( _v[i] );
+		p[0] += tx;
+		p[1] += ty;
+	}
+}
+
+void phoenix::scaleVertices( Vertex* _v, unsigned int _n, const Vector2d& _s )
+{
+	const float sx = _s.getX(), sy = _s.getY();
+	for( unsigned int i = 0; i < _n; ++i )
+	{
+		float* p = position( _v[i] );
+		p[0] *= sx;
+		p[1] *= sy;
+	}
+}
+
+void phoenix::transformVertices( Vertex* _v, unsigned int _n, const AffineTransform& _a )
+{
+	for( unsigned int i = 0; i < _n; ++i )
+	{
+		float* p = position( _v[i] );
+		const float x = p[0], y = p[1];
+		p[0] = _a.a * x + _a.b * y + _a.tx;
+		p[1] = _a.c * x + _a.d * y + _a.ty;
+	}
+}
+
+#endif
+
+void phoenix::rotateVertices( Vertex* _v, unsigned int _n, const RotationMatrix& _m )
+{
+	transformVertices( _v, _n, AffineTransform( Vector2d( 1.0f, 1.0f ), _m, Vector2d( 0.0f, 0.0f ) ) );
+}
+
+void phoenix::transformVertices( Vertex* _v, unsigned int _n, const Vector2d& _s, const RotationMatrix& _m, const Vector2d& _t )
+{
+	// The scale is folded into the rotation.
+	transformVertices( _v, _n, AffineTransform( _s, _m, _t ) );
+}
+
+void phoenix::colorizeVertices( Vertex* _v, unsigned int _n, const Color& _c )
+{
+	for( unsigned int i = 0; i < _n; ++i )
+	{
+		_v[i].color = _c;
+	}
+}
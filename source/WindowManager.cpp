@@ -1,6 +1,6 @@
-#include "WindowManager.h"
-
-using namespace phoenix;
-
-//! Static initialization
+#include "WindowManager.h"
+
+using namespace phoenix;
+
+//! Static initialization
 WindowManagerPtr WindowManager::instance = WindowManagerPtr();
\ No newline at end of file
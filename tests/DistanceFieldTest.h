@@ -0,0 +1,99 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <sstream>
+#include <vector>
+#include "Phoenix.h"
+#include "BMFontLoader.h"
+#include "DroidSansMono.h"
+
+using namespace phoenix;
+using namespace std;
+
+class DistanceFieldTest
+{
+    public:
+
+        DistanceFieldTest() : system(Vector2d(800,600))
+        {
+        }
+
+        virtual ~DistanceFieldTest()
+        {
+        }
+
+        /*!
+            This actually runs this test. It verifies:
+            *) How long a 1024x1024 distance field takes to generate with one thread and with every core.
+            *) That a distance field font draws crisp text at several scales, all from one page in one batch.
+        */
+        int run()
+        {
+            // A field of circles to time the generator with.
+            const unsigned int size = 1024;
+            std::vector<GLubyte> src( size*size*4, 0 ), dst( size*size*4 );
+            for( unsigned int y = 0; y < size; ++y )
+            {
+                for( unsigned int x = 0; x < size; ++x )
+                {
+                    const int dx = (int)(x%64) - 32, dy = (int)(y%64) - 32;
+                    src[ (y*size + x)*4 + 3 ] = ( dx*dx + dy*dy < 400 ) ? 255 : 0;
+                }
+            }
+
+            Timer timer;
+            DistanceFieldGenerator single( 8.0f, 1 ), multi( 8.0f );
+
+            timer.start();
+            single.generate( &src[0], size, size, &dst[0] );
+            double single_time = timer.getTime();
+
+            timer.reset();
+            multi.generate( &src[0], size, size, &dst[0] );
+            double multi_time = timer.getTime();
+
+            // A copy of the default font, as a distance field.
+            BitmapFontPtr font = new BitmapFont( system.getResourceManager(), system.getBatchRenderer() );
+            BMFontLoader ldr( system, font );
+            ldr.loadFromString( get_droid_sans_mono_fnt_file() );
+            font->setPage( 0, system.loadTexture( get_droid_sans_mono_file_data(), get_droid_sans_mono_file_size(), std::string("Droid Sans Mono") ) );
+
+            timer.reset();
+            bool shaded = font->makeDistanceField( 1 );
+            double font_time = timer.getTime();
+
+            float y = 150.0f;
+            for( float scale = 0.5f; scale <= 4.0f; scale *= 2.0f )
+            {
+                font->createText( "Distance fields!", Vector2d(16,y), Color(255,255,255), Vector2d(scale,scale) );
+                y += 20.0f * scale + 8.0f;
+            }
+
+            std::stringstream results;
+            results<<"Distance Field Test: "<<size<<"x"<<size<<"\n";
+            results<<"1 thread: "<<single_time*1000.0<<"ms\n";
+            results<<"All cores: "<<multi_time*1000.0<<"ms\n";
+            results<<"Font pages: "<<font_time*1000.0<<"ms, shader "<<( shaded ? "ready" : "unavailable" )<<"\n";
+
+            cout<<results.str();
+            system.getDebugConsole()<<"\n"<<results.str();
+
+            while( system.run() )
+            {
+                system.drawText( results.str(), Vector2d(16,16) );
+            }
+
+            return 0;
+
+        }// Run
+
+    protected:
+        RenderSystem system;
+    private:
+};
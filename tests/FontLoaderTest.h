@@ -0,0 +1,147 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <sstream>
+#include <vector>
+#include "Phoenix.h"
+#include "BMFontLoader.h"
+
+using namespace phoenix;
+using namespace std;
+
+class FontLoaderTest
+{
+    public:
+
+        FontLoaderTest() : system(Vector2d(800,600))
+        {
+        }
+
+        virtual ~FontLoaderTest()
+        {
+        }
+
+        //! Builds a large synthetic font (like a CJK font) in the text format.
+        std::string makeTextFont( int _chars, int _kernings )
+        {
+            std::stringstream s;
+            s<<"info face=\"Synthetic\" size=32 bold=0 italic=0 charset=\"\" unicode=1 stretchH=100 smooth=1 aa=1 padding=0,0,0,0 spacing=1,1\n";
+            s<<"common lineHeight=32 base=26 scaleW=4096 scaleH=4096 pages=1 packed=0\n";
+            s<<"chars count="<<_chars<<"\n";
+            for( int i = 0; i < _chars; ++i )
+            {
+                s<<"char id="<<(i+32)<<"   x="<<(i%128)*32<<"    y="<<(i/128)*32<<"    width=30    height=30    xoffset=-1    yoffset=2     xadvance=28    page=0  chnl=15\n";
+            }
+            s<<"kernings count="<<_kernings<<"\n";
+            for( int i = 0; i < _kernings; ++i )
+            {
+                s<<"kerning first="<<(i%_chars+32)<<"  second="<<((i*7)%_chars+32)<<"  amount=-"<<(i%3)<<"\n";
+            }
+            return s.str();
+        }
+
+        //! Builds the same font in the binary format.
+        std::vector<unsigned char> makeBinaryFont( int _chars, int _kernings )
+        {
+            std::vector<unsigned char> b;
+            b.push_back('B'); b.push_back('M'); b.push_back('F'); b.push_back(3);
+
+            //common
+            block( b, 2, 15 );
+            u16( b, 32 ); u16( b, 26 ); u16( b, 4096 ); u16( b, 4096 ); u16( b, 1 );
+            for( int i = 0; i < 5; ++i ) b.push_back(0);
+
+            //chars
+            block( b, 4, _chars*20 );
+            for( int i = 0; i < _chars; ++i )
+            {
+                u32( b, i+32 ); u16( b, (i%128)*32 ); u16( b, (i/128)*32 ); u16( b, 30 ); u16( b, 30 );
+                u16( b, (unsigned short)-1 ); u16( b, 2 ); u16( b, 28 ); b.push_back(0); b.push_back(15);
+            }
+
+            //kerning pairs
+            block( b, 5, _kernings*10 );
+            for( int i = 0; i < _kernings; ++i )
+            {
+                u32( b, i%_chars+32 ); u32( b, (i*7)%_chars+32 ); u16( b, (unsigned short)-(i%3) );
+            }
+            return b;
+        }
+
+        /*!
+            This actually runs this test. It verifies:
+            *) That the text and binary BMFont formats can be parsed.
+            *) How long it takes to parse a large font (20k characters, 100k kerning pairs) in each format.
+        */
+        int run()
+        {
+            const int chars = 20000, kernings = 100000, runs = 5;
+
+            std::string text = makeTextFont( chars, kernings );
+            std::vector<unsigned char> binary = makeBinaryFont( chars, kernings );
+
+            Timer timer;
+            double text_time = 0, binary_time = 0;
+
+            for( int i = 0; i < runs; ++i )
+            {
+                BitmapFontPtr font = new BitmapFont( system.getResourceManager(), system.getBatchRenderer() );
+                BMFontLoader ldr( system, font );
+                timer.reset();
+                ldr.loadFromString( text );
+                text_time += timer.getTime();
+                font->drop();
+
+                font = new BitmapFont( system.getResourceManager(), system.getBatchRenderer() );
+                BMFontLoader bldr( system, font );
+                timer.reset();
+                bldr.loadFromMemory( (const char*) &binary[0], (const char*) &binary[0] + binary.size() );
+                binary_time += timer.getTime();
+                font->drop();
+            }
+
+            std::stringstream results;
+            results<<"Font Loader Test: "<<chars<<" characters, "<<kernings<<" kerning pairs, average of "<<runs<<" runs\n";
+            results<<"Text ("<<text.size()/1024<<"KB): "<<text_time/runs*1000.0<<"ms\n";
+            results<<"Binary ("<<binary.size()/1024<<"KB): "<<binary_time/runs*1000.0<<"ms\n";
+
+            cout<<results.str();
+            system.getDebugConsole()<<"\n"<<results.str();
+
+            while( system.run() )
+            {
+                system.drawText( results.str(), Vector2d(16,16) );
+            }
+
+            return 0;
+
+        }// Run
+
+    protected:
+
+        //! Writes a block header.
+        void block( std::vector<unsigned char>& _b, unsigned char _type, unsigned int _size )
+        {
+            _b.push_back( _type );
+            u32( _b, _size );
+        }
+
+        //! Writes little endian values.
+        void u16( std::vector<unsigned char>& _b, unsigned int _v )
+        {
+            _b.push_back( _v & 0xff ); _b.push_back( (_v>>8) & 0xff );
+        }
+        void u32( std::vector<unsigned char>& _b, unsigned int _v )
+        {
+            u16( _b, _v & 0xffff ); u16( _b, _v >> 16 );
+        }
+
+        RenderSystem system;
+    private:
+};
@@ -0,0 +1,28 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <cstdlib>
+#include <new>
+#include "ImmediateAllocations.h"
+
+// Replacing the global operator new affects everything in the program, so this is only built into the Immediate Test.
+boost::detail::atomic_count immediate_test_allocations( 0 );
+
+void* operator new( std::size_t _size )
+{
+    ++immediate_test_allocations;
+    void* p = std::malloc( _size ? _size : 1 );
+    if( !p ) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete( void* _p ) throw()
+{
+    std::free( _p );
+}
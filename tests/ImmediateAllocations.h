@@ -0,0 +1,18 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#ifndef __PHIMMEDIATEALLOCATIONS_H__
+#define __PHIMMEDIATEALLOCATIONS_H__
+
+#include <boost/detail/atomic_count.hpp>
+
+//! Every allocation made by the Immediate Test's program, on any thread (the garbage collector allocates too).
+extern boost::detail::atomic_count immediate_test_allocations;
+
+#endif //__PHIMMEDIATEALLOCATIONS_H__
@@ -0,0 +1,135 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <sstream>
+#include <vector>
+#include "Phoenix.h"
+#include "ImmediateAllocations.h"
+
+using namespace phoenix;
+using namespace std;
+
+class ImmediateTest
+{
+    public:
+
+        ImmediateTest() : system(Vector2d(800,600))
+        {
+        }
+
+        virtual ~ImmediateTest()
+        {
+        }
+
+        /*!
+            This actually runs this test. It verifies:
+            *) How long it takes to make and draw 100,000 immediate rectangles each frame.
+            *) That the renderer's arena stops growing after the first frame.
+            *) How many allocations each frame, and each persistent rectangle, takes.
+            *) How long drawing ten buckets of 10,000 persistent quads takes, and that it doesn't allocate.
+        */
+        int run()
+        {
+            const unsigned int rects = 100000;
+            const unsigned int frames = 120;
+
+            BatchRenderer& renderer = system.getBatchRenderer();
+            Timer timer;
+
+            double make_time = 0.0, draw_time = 0.0;
+            unsigned int first_arena = 0;
+            unsigned int frame = 0;
+            unsigned long frame_allocations = 0;
+
+            std::stringstream results;
+
+            bool running = true;
+            while( running )
+            {
+                if( frame < frames )
+                {
+                    timer.reset();
+                    unsigned long allocations = immediate_test_allocations;
+
+                    for( unsigned int i = 0; i < rects; ++i )
+                    {
+                        float x = (float)( (i*7) % 800 ), y = (float)( (i*13 + frame) % 600 );
+                        system.drawRectangle( Rectangle( x, y, 4, 4 ), Color( i%255, 128, 255 - i%255 ) );
+                    }
+
+                    make_time += timer.getTime();
+                    if( frame > 0 ) frame_allocations += immediate_test_allocations - allocations;
+                    timer.reset();
+
+                    running = system.run();
+
+                    draw_time += timer.getTime();
+                    if( frame == 0 ) first_arena = renderer.getArenaSize();
+
+                    ++frame;
+                    if( frame == frames )
+                    {
+                        // Persistent geometry, made and then dropped.
+                        unsigned long allocations = immediate_test_allocations;
+                        for( unsigned int i = 0; i < 10000; ++i )
+                        {
+                            BatchGeometryPtr geom = new BatchGeometry( renderer, Rectangle( 0, 0, 4, 4 ) );
+                            geom->drop();
+                        }
+                        double per_rect = ( immediate_test_allocations - allocations ) / 10000.0;
+
+                        // Ten buckets of 10,000 persistent quads, drawn for a few frames.
+                        std::vector< BatchGeometryPtr > quads;
+                        quads.reserve( 100000 );
+                        for( unsigned int i = 0; i < 100000; ++i )
+                        {
+                            BatchGeometryPtr geom = new BatchGeometry( renderer, Rectangle( (float)( (i*7) % 800 ), (float)( (i*13) % 600 ), 4, 4 ) );
+                            geom->setGroup( i % 10 );
+                            geom->update();
+                            quads.push_back( geom );
+                        }
+
+                        running = system.run();
+                        timer.reset();
+                        allocations = immediate_test_allocations;
+                        for( unsigned int i = 0; i < 60 && running; ++i )
+                            running = system.run();
+                        double bucket_time = timer.getTime() / 60;
+                        double bucket_allocations = ( immediate_test_allocations - allocations ) / 60.0;
+
+                        BOOST_FOREACH( BatchGeometryPtr& geom, quads ) geom->drop();
+                        quads.clear();
+
+                        results<<"Immediate Test: "<<rects<<" rectangles a frame over "<<frames<<" frames\n";
+                        results<<"Making: "<<( make_time / frames )*1000.0<<"ms a frame\n";
+                        results<<"Drawing: "<<( draw_time / frames )*1000.0<<"ms a frame\n";
+                        results<<"Arena: "<<first_arena<<" after the first frame, "<<renderer.getArenaSize()<<" now\n";
+                        results<<"Geometry: "<<sizeof( BatchGeometry )<<" bytes each\n";
+                        results<<"Allocations: "<<frame_allocations / ( frames - 1 )<<" a frame after the first, "<<per_rect<<" for each persistent rectangle\n";
+                        results<<"Buckets: 10 of 10000 quads, "<<bucket_time*1000.0<<"ms and "<<bucket_allocations<<" allocations a frame\n";
+
+                        cout<<results.str();
+                        system.getDebugConsole()<<"\n"<<results.str();
+                    }
+                }
+                else
+                {
+                    system.drawText( results.str(), Vector2d(16,16) );
+                    running = system.run();
+                }
+            }
+
+            return 0;
+
+        }// Run
+
+    protected:
+        RenderSystem system;
+    private:
+};
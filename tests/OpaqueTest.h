@@ -0,0 +1,92 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <sstream>
+#include <vector>
+#include "Phoenix.h"
+
+using namespace phoenix;
+using namespace std;
+
+class OpaqueTest
+{
+    public:
+
+        OpaqueTest() : system(Vector2d(800,600))
+        {
+        }
+
+        virtual ~OpaqueTest()
+        {
+        }
+
+        /*!
+            This actually runs this test. It verifies:
+            *) That opaque geometry spread over many depths and groups still overlaps in depth order with the opaque pass on.
+            *) That translucent geometry is still blended over the opaque geometry behind it, and under what's in front of it.
+            *) How many depth layers are drawn, and how long a frame takes, with and without the opaque pass (space toggles it).
+        */
+        int run()
+        {
+            BatchRenderer& renderer = system.getBatchRenderer();
+
+            // A grid of overlapping opaque squares, each row a different depth and group, so they can only
+            // be batched together across depths.
+            std::vector< BatchGeometryPtr > geoms;
+            for( unsigned int i = 0; i < 2000; ++i )
+            {
+                unsigned int row = i / 50, column = i % 50;
+                BatchGeometryPtr g = new BatchGeometry( renderer, Rectangle( column * 15.0f + ( row % 2 ) * 7.0f, row * 13.0f + 40.0f, 20, 20 ), TexturePtr(), row % 4, (float) row );
+                g->colorize( Color( ( row * 40 ) % 255, ( column * 5 ) % 255, 255 - ( row * 40 ) % 255 ) );
+                g->setOpaque( true );
+                g->update();
+                geoms.push_back( g );
+            }
+
+            // Translucent bars across the middle, between the rows in depth.
+            for( unsigned int i = 0; i < 10; ++i )
+            {
+                BatchGeometryPtr g = new BatchGeometry( renderer, Rectangle( 0, 60.0f + i * 50.0f, 800, 12 ), TexturePtr(), 0, i * 4.0f + 1.5f );
+                g->colorize( Color( 255, 255, 255, 128 ) );
+                geoms.push_back( g );
+            }
+
+            Timer timer;
+            double frame_time = 0.0;
+            unsigned int frames = 0;
+            timer.start();
+
+            while( system.run() )
+            {
+                if( EventReceiver::Instance()->getKeyPressed( PHK_SPACE ) )
+                {
+                    renderer.setOpaquePass( ! renderer.getOpaquePass() );
+                    frame_time = 0.0;
+                    frames = 0;
+                }
+
+                frame_time += timer.getTime();
+                ++frames;
+                timer.reset();
+
+                std::stringstream status;
+                status<<"Opaque pass "<<( renderer.getOpaquePass() ? "on" : "off" )<<" (space toggles), "
+                    <<renderer.getDepthLayerCount()<<" depths drawn by depth, "
+                    <<( frame_time / frames ) * 1000.0<<"ms a frame";
+                system.drawText( status.str(), Vector2d(16,16) );
+            }
+
+            return 0;
+
+        }// Run
+
+    protected:
+        RenderSystem system;
+    private:
+};
@@ -0,0 +1,184 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <cstdio>
+#include <sstream>
+#include "Phoenix.h"
+#include "BMFontLoader.h"
+
+using namespace phoenix;
+using namespace std;
+
+class TextLayoutTest
+{
+    public:
+
+        TextLayoutTest() : system(Vector2d(800,600))
+        {
+        }
+
+        virtual ~TextLayoutTest()
+        {
+        }
+
+        //! Builds a font with every printable ASCII character, kerned against every other one.
+        std::string makeKernedFont()
+        {
+            std::stringstream s;
+            s<<"common lineHeight=16 base=13 scaleW=256 scaleH=256 pages=0 packed=0\n";
+            for( int i = 32; i < 127; ++i )
+            {
+                s<<"char id="<<i<<" x="<<((i-32)%16)*16<<" y="<<((i-32)/16)*16<<" width=14 height=16 xoffset=0 yoffset=0 xadvance=9 page=0\n";
+            }
+            for( int i = 32; i < 127; ++i )
+            {
+                for( int j = 32; j < 127; ++j )
+                {
+                    if( (i+j) % 3 == 0 ) s<<"kerning first="<<i<<" second="<<j<<" amount=-1\n";
+                }
+            }
+            return s.str();
+        }
+
+        //! Builds a font with 4096 CJK ideographs (U+4E00 on), plus ASCII.
+        std::string makeCjkFont()
+        {
+            std::stringstream s;
+            s<<"common lineHeight=16 base=13 scaleW=256 scaleH=256 pages=0 packed=0\n";
+            for( int i = 32; i < 127; ++i )
+            {
+                s<<"char id="<<i<<" x=0 y=0 width=14 height=16 xoffset=0 yoffset=0 xadvance=9 page=0\n";
+            }
+            for( int i = 0; i < 4096; ++i )
+            {
+                s<<"char id="<<(0x4E00+i)<<" x="<<(i%16)*16<<" y="<<((i/16)%16)*16<<" width=16 height=16 xoffset=0 yoffset=0 xadvance=16 page=0\n";
+            }
+            return s.str();
+        }
+
+        //! Encodes a code point as UTF-8.
+        void appendUtf8( std::string& _s, unsigned int _cp )
+        {
+            if( _cp < 0x80 ) { _s += (char) _cp; return; }
+            if( _cp < 0x800 ) { _s += (char)( 0xC0 | (_cp>>6) ); }
+            else { _s += (char)( 0xE0 | (_cp>>12) ); _s += (char)( 0x80 | ((_cp>>6)&0x3F) ); }
+            _s += (char)( 0x80 | (_cp&0x3F) );
+        }
+
+        /*!
+            This actually runs this test. It verifies:
+            *) How many glyphs per second can be laid out (getTextDimensions()) with a densely kerned font.
+            *) How many glyphs per second can be drawn (drawText()) with the same font.
+            *) That a retained counter (createText()) is updated in place instead of laid out again.
+            *) How many glyphs per second of UTF-8 CJK text can be laid out, compared to ASCII.
+            *) How long the open debug console takes to draw with a line written every frame, and how many lines it laid out.
+        */
+        int run()
+        {
+            BitmapFontPtr font = new BitmapFont( system.getResourceManager(), system.getBatchRenderer() );
+            font->setPage( 0, system.getFont()->getTexture() );
+            BMFontLoader ldr( system, font );
+            ldr.loadFromString( makeKernedFont() );
+
+            std::string text;
+            for( int i = 0; i < 64; ++i )
+            {
+                text += "The quick brown fox jumps over the lazy dog. Sphinx of black quartz, judge my vow!\n";
+            }
+
+            const int layout_runs = 2000, draw_runs = 200;
+            Timer timer;
+
+            timer.start();
+            for( int i = 0; i < layout_runs; ++i )
+            {
+                font->getTextDimensions( text );
+            }
+            double layout_time = timer.getTime();
+
+            timer.reset();
+            for( int i = 0; i < draw_runs; ++i )
+            {
+                font->drawText( text )->drop();
+            }
+            double draw_time = timer.getTime();
+
+            // A score counter that changes every frame.
+            TextGeometryPtr counter = font->createText( "Score: 00000000", Vector2d(16,300) );
+            char buffer[32];
+            timer.reset();
+            for( int i = 0; i < draw_runs*100; ++i )
+            {
+                sprintf( buffer, "Score: %08d", i );
+                counter->setText( buffer );
+            }
+            double counter_time = timer.getTime();
+
+            // The same number of characters of CJK text.
+            BitmapFontPtr cjk_font = new BitmapFont( system.getResourceManager(), system.getBatchRenderer() );
+            cjk_font->setPage( 0, system.getFont()->getTexture() );
+            BMFontLoader cjk_ldr( system, cjk_font );
+            cjk_ldr.loadFromString( makeCjkFont() );
+
+            std::string cjk_text;
+            unsigned int cjk_glyphs = 0;
+            for( unsigned int i = 0; cjk_glyphs < text.size(); ++i, ++cjk_glyphs )
+            {
+                appendUtf8( cjk_text, i % 84 == 83 ? '\n' : 0x4E00 + ( (i*37) % 4096 ) );
+            }
+
+            timer.reset();
+            for( int i = 0; i < layout_runs; ++i )
+            {
+                cjk_font->getTextDimensions( cjk_text );
+            }
+            double cjk_time = timer.getTime();
+
+            // Verbose logging into the open console.
+            DebugConsole& console = system.getDebugConsole();
+            const bool console_enabled = console.getEnabled();
+            const unsigned int console_layouts = console.getLayoutCount();
+            console.setEnabled( true );
+            timer.reset();
+            for( int i = 0; i < draw_runs*10; ++i )
+            {
+                console<<"Frame "<<i<<": the quick brown fox jumps over the lazy dog\n";
+                console.draw();
+                console.draw();
+            }
+            double console_time = timer.getTime();
+            console.setEnabled( console_enabled );
+
+            std::stringstream results;
+            results<<"Text Layout Test: "<<font->getKerningCount()<<" kerning pairs, "<<text.size()<<" glyphs per string\n";
+            results<<"getTextDimensions(): "<<(text.size()*layout_runs)/layout_time<<" glyphs/sec\n";
+            results<<"drawText(): "<<(text.size()*draw_runs)/draw_time<<" glyphs/sec\n";
+            results<<"getTextDimensions() UTF-8 CJK: "<<(cjk_glyphs*layout_runs)/cjk_time<<" glyphs/sec, "<<cjk_font->getBlockCount()<<" glyph blocks\n";
+            results<<"DebugConsole::draw(): "<<console_time/(draw_runs*10)*1000.0<<"ms per frame, "<<console.getLayoutCount()-console_layouts<<" lines laid out in "<<draw_runs*10<<" frames\n";
+            results<<"TextGeometry::setText(): "<<(draw_runs*100)/counter_time<<" updates/sec, "<<counter->getLayoutCount()<<" layouts, "<<counter->getUpdateCount()<<" in place\n";
+
+            cout<<results.str();
+            system.getDebugConsole()<<"\n"<<results.str();
+
+            int frame = 0;
+            while( system.run() )
+            {
+                system.drawText( results.str(), Vector2d(16,16) );
+                sprintf( buffer, "Score: %08d", ++frame );
+                counter->setText( buffer );
+            }
+
+            return 0;
+
+        }// Run
+
+    protected:
+        RenderSystem system;
+    private:
+};
@@ -0,0 +1,186 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <sstream>
+#include <vector>
+#include <cstdlib>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include "Phoenix.h"
+
+using namespace phoenix;
+using namespace std;
+
+// Geometry that keeps count of how many of it are alive, so leaks and double deletes show up.
+class CountedGeometry
+    : public BatchGeometry
+{
+    public:
+
+        CountedGeometry( BatchRenderer& _r, const Rectangle& _rect )
+            : BatchGeometry( _r, _rect )
+        {
+            boost::mutex::scoped_lock l( counter_mutex );
+            ++alive;
+            ++made;
+        }
+
+        virtual ~CountedGeometry()
+        {
+            boost::mutex::scoped_lock l( counter_mutex );
+            --alive;
+        }
+
+        static boost::mutex counter_mutex;
+        static long alive;
+        static long made;
+};
+
+boost::mutex CountedGeometry::counter_mutex;
+long CountedGeometry::alive = 0;
+long CountedGeometry::made = 0;
+
+class ThreadTest
+{
+    public:
+
+        ThreadTest() : system(Vector2d(800,600)), stop(false)
+        {
+        }
+
+        virtual ~ThreadTest()
+        {
+        }
+
+        /*!
+            This actually runs this test. It verifies:
+            *) That geometry can be made, shared between threads, and dropped from several threads while the renderer draws.
+            *) That every piece of geometry is deleted once, and only once, after all of it has been dropped.
+        */
+        int run()
+        {
+            const unsigned int workers = 4;
+            const unsigned int frames = 300;
+
+            BatchRenderer& renderer = system.getBatchRenderer();
+
+            boost::thread_group threads;
+            for( unsigned int i = 0; i < workers; ++i )
+                threads.create_thread( boost::bind( &ThreadTest::work, this, i ) );
+
+            unsigned int frame = 0;
+            while( frame < frames && system.run() )
+            {
+                std::stringstream status;
+                status<<"Thread Test: "<<workers<<" threads, frame "<<frame<<" of "<<frames<<"\n";
+                {
+                    boost::mutex::scoped_lock l( CountedGeometry::counter_mutex );
+                    status<<"Made: "<<CountedGeometry::made<<", alive: "<<CountedGeometry::alive<<"\n";
+                }
+                system.drawText( status.str(), Vector2d(16,16) );
+                ++frame;
+            }
+
+            {
+                boost::mutex::scoped_lock l( shared_mutex );
+                stop = true;
+            }
+            threads.join_all();
+
+            // Everything left is dropped here, then collected (clean() only gets through part of the recycle list each call).
+            BOOST_FOREACH( BatchGeometryPtr& geom, shared ) geom->drop();
+            shared.clear();
+            for( unsigned int i = 0; i < 100 && renderer.count() > 0; ++i )
+                renderer.clean();
+
+            std::stringstream results;
+            results<<"Thread Test: "<<workers<<" threads over "<<frame<<" frames\n";
+            results<<"Made: "<<CountedGeometry::made<<", still alive after collection: "<<CountedGeometry::alive<<"\n";
+            results<<( CountedGeometry::alive == 0 ? "Passed" : "Failed" )<<"\n";
+
+            cout<<results.str();
+            system.getDebugConsole()<<"\n"<<results.str();
+
+            while( system.run() )
+            {
+                system.drawText( results.str(), Vector2d(16,16) );
+            }
+
+            return 0;
+
+        }// Run
+
+    protected:
+
+        //! Makes geometry, trades pointers with the other threads, and drops them.
+        void work( unsigned int _id )
+        {
+            BatchRenderer& renderer = system.getBatchRenderer();
+            std::vector< BatchGeometryPtr > mine;
+            unsigned int seed = _id * 7919 + 1;
+
+            for( ;; )
+            {
+                {
+                    boost::mutex::scoped_lock l( shared_mutex );
+                    if( stop ) break;
+                }
+
+                // Let the collector catch up if the threads are making geometry faster than it's collected.
+                {
+                    boost::mutex::scoped_lock l( CountedGeometry::counter_mutex );
+                    if( CountedGeometry::alive > 20000 )
+                    {
+                        l.unlock();
+                        boost::this_thread::sleep( boost::posix_time::milliseconds( 1 ) );
+                        continue;
+                    }
+                }
+
+                for( unsigned int i = 0; i < 500; ++i )
+                {
+                    seed = seed * 1103515245 + 12345;
+                    float x = (float)( ( seed >> 8 ) % 800 ), y = (float)( ( seed >> 16 ) % 600 );
+                    // The geometry is in the renderer as soon as it's made, so it's colored under the renderer's lock, where draw() can't be batching it.
+                    boost::recursive_mutex::scoped_lock rl( renderer.getMutex() );
+                    BatchGeometryPtr geom = new CountedGeometry( renderer, Rectangle( x, y, 3, 3 ) );
+                    geom->colorize( Color( 64 * _id, 255 - 64 * _id, 128 ) );
+                    rl.unlock();
+                    mine.push_back( geom );
+                }
+
+                // Hand half of them over, and take some back that another thread made.
+                {
+                    boost::mutex::scoped_lock l( shared_mutex );
+                    shared.insert( shared.end(), mine.begin() + mine.size() / 2, mine.end() );
+                    mine.resize( mine.size() / 2 );
+                    if( shared.size() > 2000 )
+                    {
+                        mine.insert( mine.end(), shared.begin(), shared.begin() + 1000 );
+                        shared.erase( shared.begin(), shared.begin() + 1000 );
+                    }
+                }
+
+                // The copies in mine are let go of here, outside the lock, while the renderer holds its own.
+                BOOST_FOREACH( BatchGeometryPtr& geom, mine ) geom->drop();
+                mine.clear();
+
+                boost::this_thread::yield();
+            }
+        }
+
+        RenderSystem system;
+
+        //! Geometry that's passed between the threads.
+        std::vector< BatchGeometryPtr > shared;
+        boost::mutex shared_mutex;
+        bool stop;
+
+    private:
+};
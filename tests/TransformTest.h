@@ -0,0 +1,183 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <sstream>
+#include <vector>
+#include "Phoenix.h"
+
+using namespace phoenix;
+using namespace std;
+
+class TransformTest
+{
+    public:
+
+        TransformTest() : system(Vector2d(800,600))
+        {
+        }
+
+        virtual ~TransformTest()
+        {
+        }
+
+        /*!
+            This actually runs this test. It verifies:
+            *) How the vertex transform kernels compare to the loops BatchGeometry used to have, on 50,000 sprites.
+            *) That they give the same results.
+            *) How long moving 50,000 sprites takes with transform() and with the deferred setTransform().
+            *) That 50,000 persistent sprites can be spun around every frame with the deferred transform.
+        */
+        int run()
+        {
+            const unsigned int sprites = 50000;
+            const unsigned int passes = 20;
+
+            std::vector< Vertex > reference( sprites * 4 ), kernels;
+            for( unsigned int i = 0; i < reference.size(); ++i )
+                reference[i].position = Vector2d( (float)( i % 800 ), (float)( ( i / 800 ) % 600 ) );
+            kernels = reference;
+
+            const Vector2d t( 0.5f, -0.25f ), s( 1.001f, 0.999f );
+            const RotationMatrix m( 0.01f );
+            const Color c( 255, 128, 0 );
+
+            Timer timer;
+            double loop_times[5], kernel_times[5];
+
+            // The loops that BatchGeometry used to have.
+            timer.reset();
+            for( unsigned int p = 0; p < passes; ++p )
+                BOOST_FOREACH( Vertex& v, reference ) v.position += t;
+            loop_times[0] = timer.getTime();
+
+            timer.reset();
+            for( unsigned int p = 0; p < passes; ++p )
+                BOOST_FOREACH( Vertex& v, reference ) { v.position.setX( v.position.getX() * s.getX() ); v.position.setY( v.position.getY() * s.getY() ); }
+            loop_times[1] = timer.getTime();
+
+            timer.reset();
+            for( unsigned int p = 0; p < passes; ++p )
+                BOOST_FOREACH( Vertex& v, reference ) v.position *= m;
+            loop_times[2] = timer.getTime();
+
+            timer.reset();
+            for( unsigned int p = 0; p < passes; ++p )
+            {
+                BOOST_FOREACH( Vertex& v, reference ) { v.position.setX( v.position.getX() * s.getX() ); v.position.setY( v.position.getY() * s.getY() ); }
+                BOOST_FOREACH( Vertex& v, reference ) v.position *= m;
+                BOOST_FOREACH( Vertex& v, reference ) v.position += t;
+            }
+            loop_times[3] = timer.getTime();
+
+            timer.reset();
+            for( unsigned int p = 0; p < passes; ++p )
+                BOOST_FOREACH( Vertex& v, reference ) v.color = c;
+            loop_times[4] = timer.getTime();
+
+            // The kernels.
+            timer.reset();
+            for( unsigned int p = 0; p < passes; ++p )
+                translateVertices( &kernels[0], kernels.size(), t );
+            kernel_times[0] = timer.getTime();
+
+            timer.reset();
+            for( unsigned int p = 0; p < passes; ++p )
+                scaleVertices( &kernels[0], kernels.size(), s );
+            kernel_times[1] = timer.getTime();
+
+            timer.reset();
+            for( unsigned int p = 0; p < passes; ++p )
+                rotateVertices( &kernels[0], kernels.size(), m );
+            kernel_times[2] = timer.getTime();
+
+            timer.reset();
+            for( unsigned int p = 0; p < passes; ++p )
+                transformVertices( &kernels[0], kernels.size(), s, m, t );
+            kernel_times[3] = timer.getTime();
+
+            timer.reset();
+            for( unsigned int p = 0; p < passes; ++p )
+                colorizeVertices( &kernels[0], kernels.size(), c );
+            kernel_times[4] = timer.getTime();
+
+            // Largest difference, relative to how far the vertex is from the origin.
+            float error = 0.0f;
+            for( unsigned int i = 0; i < reference.size(); ++i )
+            {
+                float d = ( reference[i].position - kernels[i].position ).getMagnitude() / ( reference[i].position.getMagnitude() + 1.0f );
+                if( d > error ) error = d;
+                if( kernels[i].color.encode() != reference[i].color.encode() ) error = 1.0f;
+            }
+
+            const char* names[5] = { "translate", "scale", "rotate", "scale+rotate+translate", "colorize" };
+            std::stringstream results;
+            results<<"Transform Test: "<<sprites<<" sprites, "<<passes<<" passes, SSE2 "<<( PH_USE_SSE2 ? "on" : "off" )<<"\n";
+            for( unsigned int i = 0; i < 5; ++i )
+                results<<names[i]<<": "<<loop_times[i]*1000.0<<"ms before, "<<kernel_times[i]*1000.0<<"ms now\n";
+            results<<"Largest relative difference: "<<error<<"\n";
+
+            cout<<results.str();
+            system.getDebugConsole()<<"\n"<<results.str();
+
+            // Now spin some real geometry around the middle of the screen.
+            std::vector< BatchGeometryPtr > geoms;
+            geoms.reserve( sprites );
+            for( unsigned int i = 0; i < sprites; ++i )
+            {
+                BatchGeometryPtr g = new BatchGeometry( system.getBatchRenderer(), Rectangle( (float)( (i*7) % 800 ), (float)( (i*13) % 600 ), 2, 2 ) );
+                g->colorize( Color( i%255, 128, 255 - i%255 ) );
+                geoms.push_back( g );
+            }
+
+            const Vector2d center( 400, 300 );
+            const RotationMatrix spin( 0.005f );
+            const Vector2d offset = center - center * spin;
+
+            // One pass rewriting the vertices, and one just setting the deferred transform.
+            timer.reset();
+            for( unsigned int i = 0; i < geoms.size(); ++i )
+                geoms[i]->transform( Vector2d( 1, 1 ), spin, offset );
+            double rewrite_time = timer.getTime();
+
+            timer.reset();
+            for( unsigned int i = 0; i < geoms.size(); ++i )
+                geoms[i]->setTransform( center, spin, Vector2d( 1, 1 ), center );
+            double deferred_time = timer.getTime();
+
+            results<<"Moving every sprite: "<<rewrite_time*1000.0<<"ms rewriting vertices, "<<deferred_time*1000.0<<"ms deferred\n";
+            cout<<results.str();
+
+            double spin_time = 0.0;
+            unsigned int frames = 0;
+            float angle = 0.0f;
+
+            while( system.run() )
+            {
+                // Spin them with the deferred transform, the vertices are transformed as they're batched.
+                angle += 0.005f;
+                timer.reset();
+                const RotationMatrix m( angle );
+                for( unsigned int i = 0; i < geoms.size(); ++i )
+                    geoms[i]->setTransformRotation( m );
+                spin_time += timer.getTime();
+                ++frames;
+
+                std::stringstream spinning;
+                spinning<<results.str()<<"Spinning: "<<( spin_time / frames )*1000.0<<"ms a frame";
+                system.drawText( spinning.str(), Vector2d(16,16) );
+            }
+
+            return 0;
+
+        }// Run
+
+    protected:
+        RenderSystem system;
+    private:
+};
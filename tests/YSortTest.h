@@ -0,0 +1,100 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+#include <sstream>
+#include <vector>
+#include "Phoenix.h"
+
+using namespace phoenix;
+using namespace std;
+
+class YSortTest
+{
+    public:
+
+        YSortTest() : system(Vector2d(800,600))
+        {
+        }
+
+        virtual ~YSortTest()
+        {
+        }
+
+        /*!
+            This actually runs this test. It verifies:
+            *) That sprites moving up and down in a Y sorted layer overlap by their bottom edge, lowest in front.
+            *) That sprites added to the layer while it's drawn are sorted in with the rest.
+            *) How long a frame takes with the Y sorted layer, and with a depth set from y and an update() on every sprite instead (space toggles).
+        */
+        int run()
+        {
+            BatchRenderer& renderer = system.getBatchRenderer();
+            renderer.setLayerSort( 0.0f, ELS_Y );
+
+            std::vector< BatchGeometryPtr > geoms;
+            std::vector< float > speeds;
+            bool sorted = true;
+
+            Timer timer;
+            double frame_time = 0.0;
+            unsigned int frames = 0;
+            timer.start();
+
+            while( system.run() )
+            {
+                if( EventReceiver::Instance()->getKeyPressed( PHK_SPACE ) )
+                {
+                    sorted = ! sorted;
+                    renderer.setLayerSort( 0.0f, sorted ? ELS_Y : ELS_STATE );
+                    BOOST_FOREACH( BatchGeometryPtr& g, geoms ){ g->setDepth( sorted ? 0.0f : g->getSortY() ); g->update(); }
+                    frame_time = 0.0;
+                    frames = 0;
+                }
+
+                // Keep adding sprites until there's a few thousand, in three groups so they can't all be batched together.
+                if( geoms.size() < 5000 )
+                {
+                    for( unsigned int i = 0; i < 50; ++i )
+                    {
+                        unsigned int n = geoms.size();
+                        BatchGeometryPtr g = new BatchGeometry( renderer, Rectangle( (float)( ( n * 37 ) % 780 ), (float)( ( n * 7919 ) % 560 ), 20, 40 ), TexturePtr(), n % 3, 0.0f );
+                        g->colorize( Color( ( n * 40 ) % 255, ( n * 90 ) % 255, 255 - ( n * 40 ) % 255 ) );
+                        if( ! sorted ){ g->setDepth( g->getSortY() ); g->update(); }
+                        geoms.push_back( g );
+                        speeds.push_back( ( ( n * 31 ) % 7 ) * 0.25f - 0.75f );
+                    }
+                }
+
+                for( unsigned int i = 0; i < geoms.size(); ++i )
+                {
+                    const float y = geoms[i]->getSortY();
+                    if( ( y > 600.0f && speeds[i] > 0 ) || ( y < 40.0f && speeds[i] < 0 ) ) speeds[i] = -speeds[i];
+                    geoms[i]->translate( Vector2d( 0, speeds[i] ) );
+                    if( ! sorted ){ geoms[i]->setDepth( geoms[i]->getSortY() ); geoms[i]->update(); }
+                }
+
+                frame_time += timer.getTime();
+                ++frames;
+                timer.reset();
+
+                std::stringstream status;
+                status<<( sorted ? "Y sorted layer" : "Depth set from y" )<<" (space toggles), "
+                    <<geoms.size()<<" sprites, "
+                    <<( frame_time / frames ) * 1000.0<<"ms a frame";
+                system.drawText( status.str(), Vector2d(16,16) );
+            }
+
+            return 0;
+
+        }// Run
+
+    protected:
+        RenderSystem system;
+    private:
+};
@@ -0,0 +1,162 @@
+/*
+
+Copyright (c) 2010, Jonathan Wayne Parrott
+
+Please see the license.txt file included with this source
+distribution for more information.
+
+*/
+
+/*
+	phxpack - builds an AssetPack from a directory.
+
+	Usage: phxpack <directory> <output.pak>
+
+	Every file under the directory is added, named by its path relative
+	to the directory with '/' separators.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "AssetPack.h"
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+using namespace phoenix;
+using namespace std;
+
+//! Recursively lists all of the files in a directory, relative to it.
+void listFiles( const string& _root, const string& _relative, vector<string>& _files )
+{
+	string path = _root + "/" + _relative;
+
+#ifdef WIN32
+	WIN32_FIND_DATAA fd;
+	HANDLE h = FindFirstFileA( (path + "*").c_str(), &fd );
+	if( h == INVALID_HANDLE_VALUE ) return;
+	do
+	{
+		string name = fd.cFileName;
+		if( name == "." || name == ".." ) continue;
+		if( fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY )
+			listFiles( _root, _relative + name + "/", _files );
+		else
+			_files.push_back( _relative + name );
+	} while( FindNextFileA( h, &fd ) );
+	FindClose( h );
+#else
+	DIR* dir = opendir( path.c_str() );
+	if( !dir ) return;
+	while( dirent* ent = readdir( dir ) )
+	{
+		string name = ent->d_name;
+		if( name == "." || name == ".." ) continue;
+		struct stat st;
+		if( stat( (path + name).c_str(), &st ) != 0 ) continue;
+		if( S_ISDIR( st.st_mode ) )
+			listFiles( _root, _relative + name + "/", _files );
+		else if( S_ISREG( st.st_mode ) )
+			_files.push_back( _relative + name );
+	}
+	closedir( dir );
+#endif
+}
+
+//! Rounds up to a multiple of 16, so data is nicely aligned in the mapping.
+inline unsigned int align( unsigned int _x ) { return ( _x + 15 ) & ~15u; }
+
+int main( int argc, char** argv )
+{
+	if( argc != 3 )
+	{
+		cerr<<"Usage: phxpack <directory> <output.pak>"<<endl;
+		return 1;
+	}
+
+	string root = argv[1];
+	vector<string> files;
+	listFiles( root, "", files );
+
+	// Table size is a power of two at least twice the number of files.
+	unsigned int slots = 1;
+	while( slots < files.size() * 2 ) slots <<= 1;
+
+	AssetPack::Header header;
+	memset( &header, 0, sizeof(header) );
+	memcpy( header.magic, "PHXPACK", 8 );
+	header.version = AssetPack::VERSION;
+	header.count = files.size();
+	header.slots = slots;
+
+	vector<AssetPack::Entry> table( slots );
+	memset( &table[0], 0, sizeof(AssetPack::Entry) * slots );
+
+	// Names go right after the table, the data after them.
+	unsigned int offset = sizeof(AssetPack::Header) + sizeof(AssetPack::Entry) * slots;
+	vector<unsigned int> name_offsets;
+	for( size_t i = 0; i < files.size(); ++i )
+	{
+		name_offsets.push_back( offset );
+		offset += files[i].size();
+	}
+
+	vector<unsigned int> data_offsets, data_sizes;
+	for( size_t i = 0; i < files.size(); ++i )
+	{
+		ifstream in( (root + "/" + files[i]).c_str(), ios::binary | ios::ate );
+		unsigned int size = in ? (unsigned int) in.tellg() : 0;
+		offset = align( offset );
+		data_offsets.push_back( offset );
+		data_sizes.push_back( size );
+		offset += size;
+
+		// Place it in the table.
+		unsigned int h = AssetPack::hash( files[i].c_str(), files[i].size() );
+		unsigned int slot = h & (slots-1);
+		while( table[slot].offset != 0 ) slot = (slot+1) & (slots-1);
+
+		AssetPack::Entry& e = table[slot];
+		e.hash = h;
+		e.name_offset = name_offsets[i];
+		e.name_length = files[i].size();
+		e.offset = data_offsets[i];
+		e.size = size;
+	}
+
+	// Write it all out.
+	ofstream out( argv[2], ios::binary );
+	if( !out )
+	{
+		cerr<<"Could not open "<<argv[2]<<" for writing."<<endl;
+		return 1;
+	}
+
+	out.write( (const char*) &header, sizeof(header) );
+	out.write( (const char*) &table[0], sizeof(AssetPack::Entry) * slots );
+	for( size_t i = 0; i < files.size(); ++i )
+	{
+		out.write( files[i].c_str(), files[i].size() );
+	}
+	for( size_t i = 0; i < files.size(); ++i )
+	{
+		while( (unsigned int) out.tellp() < data_offsets[i] ) out.put( 0 );
+
+		ifstream in( (root + "/" + files[i]).c_str(), ios::binary );
+		if( data_sizes[i] ) out<<in.rdbuf();
+
+		cout<<files[i]<<" ("<<data_sizes[i]<<" bytes)"<<endl;
+	}
+
+	cout<<"Packed "<<files.size()<<" file(s) into "<<argv[2]<<endl;
+
+	return out.good() ? 0 : 1;
+}